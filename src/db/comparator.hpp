@@ -8,6 +8,7 @@
 
 namespace leveldb {
     namespace {
+        //Key order of formats 1 and 2, kept to read databases written before bytewise layout
         class LengthValueComparator : public leveldb::Comparator {
 
         public:
@@ -22,8 +23,11 @@ namespace leveldb {
                 return a.compare(b);
             }
 
+            //Any key shorter than start sorts before it, so start itself is the shortest key in [start, limit).
+            //LevelDB adopts a separator only when it is strictly shorter, so index keys can not be shrunk here
             void FindShortestSeparator(std::string *, const leveldb::Slice &) const override {}
 
+            //Same argument: every key shorter than key sorts before it
             void FindShortSuccessor(std::string *) const override {}
         };
 
@@ -1,58 +1,327 @@
 #include "dbConnector.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <string>
-#include <iomanip>
-#include <thread>
 #include <utility>
 #include <vector>
 #include<iostream>
 
 #include "fullKey.hpp"
+#include "leveldb/cache.h"
 #include "leveldb/db.h"
 #include "leveldb/write_batch.h"
 #include "src/utils/yamlConfig.hpp"
-#include "src/db/comparator.hpp"
+#include "src/db/filterPolicy.hpp"
 #include "src/db/fullKey.hpp"
+#include "src/db/keyCoding.hpp"
+#include "src/db/keyFormat.hpp"
+#include "src/db/logRecord.hpp"
 
-using namespace std::chrono_literals;
+namespace {
+    constexpr size_t kLseqKeyLength = 1 + FullKey::kReplicaIdLength + FullKey::kSeqNumberLength;
+
+    //Split namespaces are stored next to the values database
+    const std::string kNamespaceSuffix[] = {"", "-getseq", "-lseq", "-history"};
+
+    //Log records past the getseq index can only come from writes in flight during a crash,
+    //far fewer than this even under full write concurrency
+    constexpr int kRepairWindow = 1024;
+
+    const size_t kEmptyBatchSize = leveldb::WriteBatch().ApproximateSize();
+
+    //Readers arriving within this time after a snapshot share it, unless a write lands in between
+    constexpr std::chrono::microseconds kSnapshotEpoch(1000);
+    constexpr size_t kValueCacheShards = 16;
+    constexpr size_t kEventRingCapacity = 4096;
+
+    //Metadata key of the persisted timeline, next to the format markers
+    const std::string kTimelineKey = "~timeline";
+    //Hot keys manifest, next to the database
+    const std::string kWarmupSuffix = "-warmup";
+    constexpr uint32_t kHotKeySampleEvery = 16;
+
+    //Timeline keeps about this many samples per retention window
+    constexpr int64_t kTimelineSamples = 64;
+
+    const std::string kSeqMarkPrefix = "~seqmark";
+
+    std::string seqMarkKey(int id) {
+        std::string key = kSeqMarkPrefix;
+        KeyCoding::appendFixed32(key, static_cast<uint32_t>(id));
+        return key;
+    }
+
+    int64_t nowMillis() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+}
 
 dbConnector::dbConnector(const YAMLConfig& config)
 {
     selfId = config.getId();
     seqCount = std::vector<std::atomic<leveldb::SequenceNumber>>(config.getMaxReplicaId());
-    leveldb::Options options;
-    options.create_if_missing = true;
-    options.comparator = &(leveldb::GLOBAL_COMPARATOR);
-    leveldb::DB* raw_db;
-    leveldb::Status status = leveldb::DB::Open(options,  config.getDbFile(), &raw_db);
+    const StorageConfig& storage = config.getStorageConfig();
+    if (storage.bloomBitsPerKey > 0) {
+        filterPolicy = std::make_unique<NamespaceFilterPolicy>(storage.bloomBitsPerKey);
+    }
+    splitNamespaces = storage.splitNamespaces;
+    leveldb::SequenceNumber seqBase;
+    leveldb::Status status = KeyFormat::open(namespaceOptions(storage, VALUES), config.getDbFile(), ownedDbs[VALUES], seqBase);
+    if (status.ok()) {
+        status = KeyFormat::checkLayout(ownedDbs[VALUES].get(), splitNamespaces);
+    }
+    for (int ns = GETSEQ; splitNamespaces && status.ok() && ns < NAMESPACE_COUNT; ++ns) {
+        leveldb::DB* raw_db;
+        status = leveldb::DB::Open(namespaceOptions(storage, static_cast<KeyNamespace>(ns)), config.getDbFile() + kNamespaceSuffix[ns], &raw_db);
+        if (status.ok()) {
+            ownedDbs[ns].reset(raw_db);
+        }
+    }
+    for (int ns = VALUES; status.ok() && ns < NAMESPACE_COUNT; ++ns) {
+        dbs[ns] = ownedDbs[ns] ? ownedDbs[ns].get() : ownedDbs[VALUES].get();
+    }
+    if (status.ok()) {
+        std::vector<leveldb::DB*> snapshotOrder;
+        for (KeyNamespace ns : {GETSEQ, LSEQ, HISTORY, VALUES}) {
+            if (splitNamespaces || ns == VALUES) {
+                snapshotOrder.push_back(dbs[ns]);
+            }
+            snapshotIndex[ns] = splitNamespaces ? snapshotOrder.size() - 1 : 0;
+        }
+        snapshotManager = std::make_unique<SnapshotManager>(std::move(snapshotOrder), kSnapshotEpoch);
+    }
+    if (status.ok()) {
+        status = KeyFormat::upgradeLog(dbs[VALUES], dbs[LSEQ], dbs[HISTORY]);
+    }
+    if (status.ok() && splitNamespaces) {
+        status = repairGetseqIndex(config.getMaxReplicaId());
+    }
+    //Every local write puts a value, so the values database has used at least as many sequence numbers
+    //as were handed out as lseqs, including those of older versions which took lseqs from LevelDB
+    if (status.ok()) {
+        status = KeyFormat::lastSequence(dbs[VALUES], lastLocalSeq);
+        lastLocalSeq += seqBase;
+    }
+    if (status.ok() && storage.retainSeconds > 0) {
+        std::string stored;
+        status = dbs[VALUES]->Get(leveldb::ReadOptions(), kTimelineKey, &stored);
+        if (status.IsNotFound()) {
+            status = leveldb::Status::OK();
+        } else if (status.ok() && !timeline.decode(stored)) {
+            status = leveldb::Status::Corruption("malformed sequence timeline");
+        }
+    }
+    if (status.ok()) {
+        status = loadSeqMarks(config.getMaxReplicaId());
+    }
     if(!status.ok()) {
-        throw std::runtime_error("failed to open leveldb");
+        throw std::runtime_error("failed to open leveldb: " + status.ToString());
     }
-    db.reset(raw_db);
 
-    for (int i = 0; i < config.getMaxReplicaId(); ++i) {
-        seqCount[i] = getMaxSeqForReplica(i);
+    valueCache = std::make_unique<ValueCache>(storage.valueCacheSize, kValueCacheShards);
+    eventRing = std::make_unique<EventRing<batchValue>>(kEventRingCapacity);
+    groupCommitWindow = std::chrono::microseconds(storage.groupCommitWindowMicros);
+    groupCommitMaxBytes = storage.groupCommitMaxBytes;
+    defaultDurability = storage.durability;
+    syncInterval = std::chrono::milliseconds(storage.syncIntervalMillis);
+    syncBytes = storage.syncBytes;
+    retainVersions = storage.retainVersions;
+    retainAge = std::chrono::seconds(storage.retainSeconds);
+    gcChunkRecords = storage.gcChunkRecords;
+    gcPause = std::chrono::milliseconds(storage.gcPauseMillis);
+    gcInterval = std::chrono::seconds(storage.gcIntervalSeconds);
+    syncerThread = std::thread(&dbConnector::syncLoop, this);
+    writerThread = std::thread(&dbConnector::writerLoop, this);
+    if (retainVersions > 0 || retainAge.count() > 0) {
+        gcThread = std::thread(&dbConnector::collectorLoop, this);
+    }
+    hotKeys = std::make_unique<HotKeys>(storage.warmupKeys, kHotKeySampleEvery);
+    warmupFile = config.getDbFile() + kWarmupSuffix;
+    warmupInterval = std::chrono::seconds(storage.warmupIntervalSeconds);
+    if (storage.warmupKeys > 0) {
+        warmupThread = std::thread(&dbConnector::warmupLoop, this);
+    } else {
+        warm = true;
     }
 }
 
-leveldb::SequenceNumber dbConnector::getMaxSeqForReplica(int id) {
-    leveldb::ReadOptions options;
-    options.snapshot = db->GetSnapshot();
-    std::unique_ptr<leveldb::Iterator> it(db->NewIterator(options));
-    leveldb::SequenceNumber seq = 0;
-    for (it->Seek(generateLseqKey(0, id));
-         it->Valid();
-         it->Next())
+dbConnector::~dbConnector() {
+    if (warmupThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(warmupMutex);
+            stopWarmup = true;
+        }
+        warmupWake.notify_all();
+        warmupThread.join();
+        leveldb::Status s = saveHotKeys();
+        if (!s.ok()) {
+            std::cerr << "Saving hot keys failed: " << s.ToString() << std::endl;
+        }
+    }
     {
-        std::string lseq = it->key().ToString();
-        if (lseq[0] != '#')
-            break;
-        if (lseq[0] == '#' && std::stoi(lseqToReplicaId(lseq)) != id)
+        std::lock_guard<std::mutex> lock(gcMutex);
+        stopGc = true;
+    }
+    gcWake.notify_all();
+    if (gcThread.joinable()) {
+        gcThread.join();
+    }
+    eventRing->close();
+    //Writer goes first: it may still hand writes over to the syncer
+    {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        stopWriter = true;
+    }
+    writeReady.notify_one();
+    writerThread.join();
+    {
+        std::lock_guard<std::mutex> lock(syncMutex);
+        stopSyncer = true;
+    }
+    syncNeeded.notify_one();
+    syncerThread.join();
+}
+
+leveldb::Options dbConnector::namespaceOptions(const StorageConfig& storage, KeyNamespace ns) {
+    const NamespaceTuning* tunings[] = {&storage.values, &storage.getseq, &storage.lseq, &storage.history};
+    const NamespaceTuning& tuning = *tunings[ns];
+    leveldb::Options options;
+    options.create_if_missing = true;
+    options.filter_policy = filterPolicy.get();
+    options.block_size = tuning.blockSize;
+    options.write_buffer_size = tuning.writeBufferSize;
+    options.max_open_files = storage.maxOpenFiles;
+    options.block_restart_interval = storage.blockRestartInterval;
+    options.max_file_size = storage.maxFileSize;
+    options.compression = storage.compression == Compression::SNAPPY ? leveldb::kSnappyCompression : leveldb::kNoCompression;
+    auto cacheSize = static_cast<size_t>(splitNamespaces ? storage.blockCacheSize * tuning.cacheShare : storage.blockCacheSize);
+    if (cacheSize > 0) {
+        blockCaches[ns].reset(leveldb::NewLRUCache(cacheSize));
+        options.block_cache = blockCaches[ns].get();
+    }
+    return options;
+}
+
+leveldb::Status dbConnector::writeNamespaces(NamespaceBatches& batches, const leveldb::WriteOptions& options) {
+    if (!splitNamespaces) {
+        for (int ns = GETSEQ; ns < NAMESPACE_COUNT; ++ns) {
+            batches[VALUES].Append(batches[ns]);
+        }
+        leveldb::Status s = dbs[VALUES]->Write(options, &batches[VALUES]);
+        snapshotManager->advance();
+        return s;
+    }
+    leveldb::Status s;
+    for (KeyNamespace ns : {VALUES, HISTORY, LSEQ, GETSEQ}) {
+        if (batches[ns].ApproximateSize() == kEmptyBatchSize)
+            continue;
+        s = dbs[ns]->Write(options, &batches[ns]);
+        if (!s.ok())
             break;
-        seq = lseqToSeq(lseq);
     }
-    db->ReleaseSnapshot(options.snapshot);
-    return seq;
+    //Even a failed write may be partially visible
+    snapshotManager->advance();
+    return s;
+}
+
+leveldb::Status dbConnector::syncDatabases() {
+    leveldb::WriteOptions options;
+    options.sync = true;
+    for (int ns = VALUES; ns < NAMESPACE_COUNT; ++ns) {
+        if (ns != VALUES && !splitNamespaces)
+            continue;
+        //Empty synced write flushes everything logged before it
+        leveldb::WriteBatch empty;
+        leveldb::Status s = dbs[ns]->Write(options, &empty);
+        if (!s.ok())
+            return s;
+    }
+    return leveldb::Status::OK();
+}
+
+dbConnector::ReadView dbConnector::acquireReadView() {
+    ReadView view;
+    view.snapshots = snapshotManager->acquire();
+    for (int ns = VALUES; ns < NAMESPACE_COUNT; ++ns) {
+        view.options[ns].snapshot = view.snapshots->get(snapshotIndex[ns]);
+    }
+    return view;
+}
+
+//Split namespaces are written one by one, a crash between lseq log and getseq index writes leaves
+//log records the index does not point to. Such records can only be at the tail of a replica's log
+leveldb::Status dbConnector::repairGetseqIndex(int maxReplicaId) {
+    std::unique_ptr<leveldb::Iterator> it(dbs[LSEQ]->NewIterator(leveldb::ReadOptions()));
+    std::string current;
+    for (int id = 0; id < maxReplicaId; ++id) {
+        it->Seek(generateLseqKey(0, id + 1));
+        if (it->Valid()) {
+            it->Prev();
+        } else {
+            it->SeekToLast();
+        }
+        for (int checked = 0; it->Valid() && checked < kRepairWindow; it->Prev(), ++checked) {
+            leveldb::Slice lseq = it->key();
+            if (!isLseqKey(lseq) || lseqToReplicaId(lseq) != id)
+                break;
+            leveldb::Slice stampedKey;
+            leveldb::Slice value;
+            if (!LogRecord::decode(it->value(), stampedKey, value))
+                return leveldb::Status::Corruption("malformed log record");
+            std::string getseqKey = generateGetseqKey(stampedKey.ToString());
+            leveldb::Status s = dbs[GETSEQ]->Get(leveldb::ReadOptions(), getseqKey, &current);
+            if (!s.ok() && !s.IsNotFound())
+                return s;
+            if (s.ok() && isLseqKey(current) && lseqToSeq(current) >= lseqToSeq(lseq))
+                continue;
+            s = dbs[GETSEQ]->Put(leveldb::WriteOptions(), getseqKey, lseq);
+            if (!s.ok())
+                return s;
+        }
+    }
+    return it->status();
+}
+
+//Steps back from the first key past the replica's log, so the cost does not grow with the log
+leveldb::SequenceNumber dbConnector::getMaxSeqForReplica(int id) {
+    std::unique_ptr<leveldb::Iterator> it(dbs[LSEQ]->NewIterator(leveldb::ReadOptions()));
+    it->Seek(generateLseqKey(0, id + 1));
+    if (it->Valid()) {
+        it->Prev();
+    } else {
+        it->SeekToLast();
+    }
+    if (!it->Valid() || !isLseqKey(it->key()) || lseqToReplicaId(it->key()) != id)
+        return 0;
+    return lseqToSeq(it->key());
+}
+
+//The log can only be ahead of a mark in databases written before marks were kept
+leveldb::Status dbConnector::loadSeqMarks(int maxReplicaId) {
+    seqMarks.assign(maxReplicaId, 0);
+    std::string stored;
+    for (int id = 0; id < maxReplicaId; ++id) {
+        leveldb::Status s = dbs[LSEQ]->Get(leveldb::ReadOptions(), seqMarkKey(id), &stored);
+        if (s.ok() && stored.size() != FullKey::kSeqNumberLength)
+            return leveldb::Status::Corruption("malformed sequence mark");
+        if (s.ok())
+            seqMarks[id] = KeyCoding::decodeFixed64(stored.data());
+        else if (!s.IsNotFound())
+            return s;
+        seqMarks[id] = std::max(seqMarks[id], getMaxSeqForReplica(id));
+        seqCount[id] = seqMarks[id];
+    }
+    return leveldb::Status::OK();
+}
+
+void dbConnector::markWritten(NamespaceBatches& batches, int id, leveldb::SequenceNumber seq) {
+    if (id < 0 || static_cast<size_t>(id) >= seqMarks.size() || seq <= seqMarks[id])
+        return;
+    seqMarks[id] = seq;
+    std::string mark;
+    KeyCoding::appendFixed64(mark, seq);
+    batches[LSEQ].Put(seqMarkKey(id), mark);
 }
 
 void dbConnector::updateReplicaId(leveldb::SequenceNumber seq, size_t replicaId) {
@@ -66,111 +335,463 @@ leveldb::SequenceNumber dbConnector::sequenceNumberForReplica(int id) {
     return seqCount[id].load(std::memory_order_acquire);
 }
 
-replyFormat dbConnector::put(std::string key, std::string value) {
-    std::string realKey = generateNormalKey(key, selfId);
-    auto [seq, s] = db->PutSequence(leveldb::WriteOptions(), realKey, value);
-    if (!s.ok()) {
-        return {"", s};
+ValueCache::Stats dbConnector::valueCacheStats() const {
+    return valueCache->stats();
+}
+
+EventRing<batchValue>& dbConnector::recentEvents() {
+    return *eventRing;
+}
+
+void dbConnector::setWriteListener(std::function<void()> listener) {
+    std::lock_guard<std::mutex> lock(listenerMutex);
+    writeListener = std::move(listener);
+}
+
+void dbConnector::notifyWriteListener() {
+    std::lock_guard<std::mutex> lock(listenerMutex);
+    if (writeListener) {
+        writeListener();
     }
-    leveldb::WriteBatch batch;
-    batch.Put(generateGetseqKey(realKey), generateLseqKey(seq, selfId));
-    batch.Put(generateLseqKey(seq, selfId), realKey);
-    batch.Put(FullKey(key, seq, selfId).getFullKey(), value);
-    leveldb::Status st = db->Write(leveldb::WriteOptions(), &batch);
-    if (!st.ok()) {
-        return {"", st};
+}
+
+void dbConnector::collectorLoop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(gcMutex);
+            if (gcWake.wait_for(lock, gcInterval, [this] { return stopGc; }))
+                return;
+        }
+        leveldb::Status s = collectHistory();
+        if (!s.ok()) {
+            std::cerr << "History collection failed: " << s.ToString() << std::endl;
+        }
     }
-        
-    updateReplicaId(seq, selfId);
-    return {generateLseqKey(seq, selfId), st};
 }
 
-replyFormat dbConnector::remove(std::string key) {
-    std::string realKey = generateNormalKey(key, selfId);
-    auto [seq, s] = db->DeleteSequence(leveldb::WriteOptions(), realKey);
+bool dbConnector::warmedUp() const {
+    return warm.load();
+}
+
+void dbConnector::warmupLoop() {
+    std::vector<std::string> keys;
+    leveldb::Status s = HotKeys::load(warmupFile, keys);
     if (!s.ok()) {
-        return {"", s};
+        std::cerr << "Cache warmup skipped: " << s.ToString() << std::endl;
     }
-    leveldb::Status intermediateStatus = db->Put(leveldb::WriteOptions(), generateGetseqKey(realKey), generateLseqKey(seq, selfId));
-    if (!intermediateStatus.ok()) {
-        return {"", intermediateStatus};
+    //An idle restart keeps the manifest as it was
+    hotKeys->seed(keys);
+    //Same path as get, which brings index and log blocks into the block cache and fills the value cache
+    for (const auto& realKey : keys) {
+        {
+            std::lock_guard<std::mutex> lock(warmupMutex);
+            if (stopWarmup)
+                break;
+        }
+        if (realKey.size() >= FullKey::kReplicaIdLength) {
+            get(stampedKeyToRealKey(realKey), static_cast<int>(KeyCoding::decodeFixed32(realKey.data())));
+        }
+    }
+    warm = true;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(warmupMutex);
+            if (warmupWake.wait_for(lock, warmupInterval, [this] { return stopWarmup; }))
+                return;
+        }
+        s = saveHotKeys();
+        if (!s.ok()) {
+            std::cerr << "Saving hot keys failed: " << s.ToString() << std::endl;
+        }
     }
-    auto [secondSeq, st] = db->DeleteSequence(leveldb::WriteOptions(), generateLseqKey(seq, selfId));
-    updateReplicaId(secondSeq, selfId);
-    
-    return {generateLseqKey(seq, selfId), st};
 }
 
-pureReplyValue dbConnector::get(std::string key) {
-    static constexpr int kMaxReadRetryCount = 100;
+leveldb::Status dbConnector::saveHotKeys() {
+    std::vector<std::string> keys = hotKeys->keys();
+    if (keys.empty()) {
+        return leveldb::Status::OK();
+    }
+    return HotKeys::save(warmupFile, keys);
+}
 
-    int cnt = 0;
-    std::string realKey = generateNormalKey(key, selfId);
-    std::string lseqKey = generateGetseqKey(realKey);
-    std::string subSearchKey;
+leveldb::Status dbConnector::collectHistory() {
+    std::lock_guard<std::mutex> pass(collectMutex);
+    if (retainVersions == 0 && retainAge.count() == 0) {
+        return leveldb::Status::OK();
+    }
+    leveldb::Status s;
+    std::vector<leveldb::SequenceNumber> covered;
+    if (retainAge.count() > 0) {
+        int64_t now = nowMillis();
+        s = sampleTimeline(now);
+        covered = timeline.coveredAt(now - retainAge.count());
+    }
+    //History keys start with '!', so the pass begins at the first of them
+    std::string resume = "!";
+    bool done = false;
+    while (s.ok() && !done) {
+        s = collectHistoryChunk(resume, covered, done);
+        if (done) {
+            break;
+        }
+        std::unique_lock<std::mutex> lock(gcMutex);
+        if (gcWake.wait_for(lock, gcPause, [this] { return stopGc; })) {
+            break;
+        }
+    }
+    return s;
+}
 
-    while (true)
+leveldb::Status dbConnector::sampleTimeline(int64_t now) {
+    std::vector<leveldb::SequenceNumber> seqs;
+    seqs.reserve(seqCount.size());
+    for (const auto& seq : seqCount) {
+        seqs.push_back(seq.load());
+    }
+    if (!timeline.record(now, seqs, std::max<int64_t>(retainAge.count() / kTimelineSamples, 1))) {
+        return leveldb::Status::OK();
+    }
+    timeline.trimBefore(now - retainAge.count());
+    return dbs[VALUES]->Put(leveldb::WriteOptions(), kTimelineKey, timeline.encode());
+}
+
+leveldb::Status dbConnector::collectHistoryChunk(std::string& resume, const std::vector<leveldb::SequenceNumber>& covered, bool& done) {
+    //Versions of a key are only judged together, so a chunk never ends inside a key
+    std::vector<std::pair<std::string, std::vector<Version>>> keys;
+    size_t scanned = 0;
+    done = true;
     {
-        ++cnt;
-        leveldb::ReadOptions options;
-        options.snapshot = db->GetSnapshot();
-        if (cnt > kMaxReadRetryCount) {
-            return {"", leveldb::Status::IOError("Unsuccessfully read. Retry when db load decreases"), std::string()};
-        }
-        std::string value;
-        auto [seq, s] = db->GetSequence(options, realKey, &value);
-        if (!s.ok()) {
-            return {"", s, std::string()};
+        std::unique_ptr<leveldb::Iterator> it(dbs[HISTORY]->NewIterator(leveldb::ReadOptions()));
+        for (it->Seek(resume); it->Valid(); it->Next()) {
+            FullKeyView version(it->key());
+            if (!version.isValid())
+                break;
+            if (keys.empty() || version.getKey() != keys.back().first) {
+                if (scanned >= gcChunkRecords) {
+                    resume = FullKey(version.getKey().ToString(), 0, 0).getFullKey();
+                    done = false;
+                    break;
+                }
+                keys.emplace_back(version.getKey().ToString(), std::vector<Version>());
+            }
+            keys.back().second.push_back({version.getSeq(), version.getReplicaId()});
+            ++scanned;
         }
-        s = db->Get(options, lseqKey, &subSearchKey);
-        if (!s.ok() && !s.IsNotFound()) {
-            return {"", s, ""};
+        if (!it->status().ok())
+            return it->status();
+    }
+    NamespaceBatches batches;
+    size_t expired = 0;
+    //Replicated writes may point an index back to an old version, they wait until the chunk is written
+    std::lock_guard<std::mutex> lock(applyMutex);
+    for (auto& [key, versions] : keys) {
+        leveldb::Status s = expireVersions(key, versions, covered, batches, expired);
+        if (!s.ok())
+            return s;
+    }
+    if (expired == 0)
+        return leveldb::Status::OK();
+    return writeNamespaces(batches, leveldb::WriteOptions());
+}
+
+leveldb::Status dbConnector::expireVersions(const std::string& key, std::vector<Version>& versions,
+                                            const std::vector<leveldb::SequenceNumber>& covered, NamespaceBatches& batches, size_t& expired) {
+    //Every replica keeps its own latest value of the key, so each one is judged on its own versions
+    std::stable_sort(versions.begin(), versions.end(), [](const Version& a, const Version& b) { return a.id < b.id; });
+    std::string indexed;
+    for (size_t first = 0, last; first < versions.size(); first = last) {
+        int id = versions[first].id;
+        for (last = first; last < versions.size() && versions[last].id == id; ++last) {}
+        bool indexRead = false;
+        //The newest version is never expired
+        for (size_t i = first; i + 1 < last; ++i) {
+            leveldb::SequenceNumber seq = versions[i].seq;
+            bool keepByCount = retainVersions > 0 && last - i <= retainVersions;
+            bool keepByAge = retainAge.count() > 0 && (static_cast<size_t>(id) >= covered.size() || seq > covered[id]);
+            if (keepByCount || keepByAge)
+                continue;
+            if (!indexRead) {
+                leveldb::Status s = dbs[GETSEQ]->Get(leveldb::ReadOptions(), generateGetseqKey(generateNormalKey(key, id)), &indexed);
+                if (s.IsNotFound())
+                    indexed.clear();
+                else if (!s.ok())
+                    return s;
+                indexRead = true;
+            }
+            std::string lseq = generateLseqKey(seq, id);
+            if (lseq == indexed)
+                continue;
+            batches[HISTORY].Delete(FullKey(key, seq, id).getFullKey());
+            batches[LSEQ].Delete(lseq);
+            ++expired;
+        }
+    }
+    return leveldb::Status::OK();
+}
+
+replyFormat dbConnector::put(std::string key, std::string value, std::optional<Durability> durability) {
+    PendingWrite write{false, std::move(key), std::move(value), durability.value_or(defaultDurability)};
+    return submitWrite(write);
+}
+
+replyFormat dbConnector::remove(std::string key, std::optional<Durability> durability) {
+    PendingWrite write{true, std::move(key), std::string(), durability.value_or(defaultDurability)};
+    return submitWrite(write);
+}
+
+replyFormat dbConnector::submitWrite(PendingWrite& write) {
+    std::future<replyFormat> result = write.done.get_future();
+    {
+        std::lock_guard<std::mutex> lock(writeMutex);
+        writeQueue.push_back(&write);
+        queuedBytes += write.key.size() + write.value.size();
+    }
+    writeReady.notify_one();
+    return result.get();
+}
+
+void dbConnector::writerLoop() {
+    std::vector<PendingWrite*> group;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(writeMutex);
+            writeReady.wait(lock, [this] { return stopWriter || !writeQueue.empty(); });
+            if (writeQueue.empty()) {
+                return;
+            }
+            if (groupCommitWindow.count() > 0) {
+                writeReady.wait_for(lock, groupCommitWindow, [this] {
+                    return stopWriter || queuedBytes >= groupCommitMaxBytes;
+                });
+            }
+            size_t groupBytes = 0;
+            while (!writeQueue.empty()) {
+                size_t bytes = writeQueue.front()->key.size() + writeQueue.front()->value.size();
+                if (!group.empty() && groupBytes + bytes > groupCommitMaxBytes)
+                    break;
+                groupBytes += bytes;
+                group.push_back(writeQueue.front());
+                writeQueue.pop_front();
+            }
+            queuedBytes -= groupBytes;
         }
-        std::string requestedKey;
-        s = db->Get(options, subSearchKey, &requestedKey);
-        if (!s.ok() && !s.IsNotFound()) {
-            return {"", s, ""};
+        commitGroup(group);
+        group.clear();
+    }
+}
+
+void dbConnector::commitGroup(std::vector<PendingWrite*>& group) {
+    NamespaceBatches batches;
+    std::vector<std::string> lseqs;
+    lseqs.reserve(group.size());
+    //One write asking for sync makes the whole group durable
+    leveldb::WriteOptions options;
+    for (PendingWrite* write : group) {
+        options.sync = options.sync || write->durability == Durability::ALWAYS;
+        //Taken even if the write fails: it may still have reached the log
+        leveldb::SequenceNumber seq = ++lastLocalSeq;
+        std::string realKey = generateNormalKey(write->key, selfId);
+        std::string lseq = generateLseqKey(seq, selfId);
+        if (write->isRemove) {
+            batches[VALUES].Delete(realKey);
+        } else {
+            batches[VALUES].Put(realKey, write->value);
+            batches[LSEQ].Put(lseq, LogRecord::encode(realKey, write->value));
+            batches[HISTORY].Put(FullKey(write->key, seq, selfId).getFullKey(), write->value);
         }
-        if (requestedKey != realKey) {
-            std::this_thread::sleep_for(100ms);
-            continue;
+        batches[GETSEQ].Put(generateGetseqKey(realKey), lseq);
+        lseqs.push_back(std::move(lseq));
+    }
+    leveldb::Status st;
+    {
+        std::lock_guard<std::mutex> lock(applyMutex);
+        markWritten(batches, selfId, lastLocalSeq);
+        st = writeNamespaces(batches, options);
+        //A failed split write may have reached some databases, so its keys are dropped rather than kept
+        batchValues events;
+        for (size_t i = 0; i < group.size(); ++i) {
+            std::string realKey = generateNormalKey(group[i]->key, selfId);
+            if (st.ok() && !group[i]->isRemove) {
+                valueCache->update(realKey, {lseqs[i], group[i]->value});
+                events.push_back({lseqs[i], std::move(realKey), group[i]->value});
+            } else {
+                valueCache->erase(realKey);
+            }
         }
-        return {subSearchKey, s, value};
+        eventRing->publish(events);
+    }
+    if (st.ok()) {
+        updateReplicaId(lastLocalSeq, selfId);
+        notifyWriteListener();
+    }
+    std::vector<std::pair<PendingWrite*, replyFormat>> unsynced;
+    size_t bytes = 0;
+    for (size_t i = 0; i < group.size(); ++i) {
+        replyFormat reply = st.ok() ? replyFormat{std::move(lseqs[i]), st} : replyFormat{"", st};
+        if (st.ok() && !options.sync && group[i]->durability == Durability::PERIODIC) {
+            bytes += group[i]->key.size() + group[i]->value.size();
+            unsynced.emplace_back(group[i], std::move(reply));
+        } else {
+            group[i]->done.set_value(std::move(reply));
+        }
+    }
+    if (!unsynced.empty()) {
+        {
+            std::lock_guard<std::mutex> lock(syncMutex);
+            syncWaiters.insert(syncWaiters.end(), unsynced.begin(), unsynced.end());
+            unsyncedBytes += bytes;
+        }
+        syncNeeded.notify_one();
     }
 }
 
-pureReplyValue dbConnector::get(std::string key, int id) {
-    if (id == selfId)
-        return get(std::move(key));
+void dbConnector::syncLoop() {
+    std::vector<std::pair<PendingWrite*, replyFormat>> covered;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(syncMutex);
+            syncNeeded.wait(lock, [this] { return stopSyncer || !syncWaiters.empty(); });
+            if (syncWaiters.empty()) {
+                return;
+            }
+            syncNeeded.wait_for(lock, syncInterval, [this] { return stopSyncer || unsyncedBytes >= syncBytes; });
+            //Every waiter taken here was applied before the sync below starts
+            covered.swap(syncWaiters);
+            unsyncedBytes = 0;
+        }
+        leveldb::Status st = syncDatabases();
+        for (auto& [write, reply] : covered) {
+            write->done.set_value(st.ok() ? std::move(reply) : replyFormat{"", st});
+        }
+        covered.clear();
+    }
+}
 
-    std::string res;
-    leveldb::ReadOptions options;
-    options.snapshot = db->GetSnapshot();
+pureReplyValue dbConnector::get(std::string key) {
+    return get(std::move(key), selfId);
+}
+
+//Follows the index instead of checking it after reading the value, so the read never waits for a write in flight:
+//a write whose index is not visible yet is simply ordered after this read
+pureReplyValue dbConnector::get(std::string key, int id) {
     std::string realKey = generateNormalKey(key, id);
-    auto [seq, s] = db->GetSequence(options, realKey, &res);
+    hotKeys->record(realKey);
+    ValueCache::Entry cached;
+    uint64_t ticket;
+    if (valueCache->lookup(realKey, cached, ticket)) {
+        return {std::move(cached.lseq), leveldb::Status::OK(), std::move(cached.value)};
+    }
+    ReadView view = acquireReadView();
+    std::string lseq;
+    leveldb::Status s = dbs[GETSEQ]->Get(view[GETSEQ], generateGetseqKey(realKey), &lseq);
+    //Log record holds exactly the indexed value, while split values database may already hold a newer one
+    std::string record;
+    if (s.ok()) {
+        s = dbs[LSEQ]->Get(view[LSEQ], lseq, &record);
+    }
+    leveldb::Slice indexedKey;
+    leveldb::Slice value;
+    if (s.ok() && !LogRecord::decode(record, indexedKey, value)) {
+        s = leveldb::Status::Corruption("malformed log record");
+    }
+    //Removal points the index to an lseq without log record
+    if (s.ok() && indexedKey != realKey) {
+        s = leveldb::Status::NotFound("key is removed");
+    }
     if (!s.ok()) {
         return {"", s, ""};
     }
-    std::string lseq;
-    s = db->Get(options, generateGetseqKey(realKey), &lseq);
-    return {lseq, s, res};
+    valueCache->fill(realKey, {lseq, value.ToString()}, ticket);
+    return {lseq, s, value.ToString()};
+}
+
+//Same index path as get, but under one view and with keys sorted, so the getseq index
+//is walked forward by one iterator instead of a lookup per key
+replyBatchFormat dbConnector::multiGet(std::vector<std::string> keys, int id) {
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+    batchValues res;
+    res.reserve(keys.size());
+    ReadView view = acquireReadView();
+    std::unique_ptr<leveldb::Iterator> lseqIt(dbs[GETSEQ]->NewIterator(view[GETSEQ]));
+    std::string record;
+    leveldb::Slice indexedKey;
+    leveldb::Slice value;
+    leveldb::Status status;
+    for (const auto& key : keys) {
+        std::string realKey = generateNormalKey(key, id);
+        hotKeys->record(realKey);
+        std::string getseqKey = generateGetseqKey(realKey);
+        if (!lseqIt->Valid() || lseqIt->key().compare(getseqKey) < 0) {
+            lseqIt->Seek(getseqKey);
+        }
+        if (!lseqIt->Valid() || lseqIt->key() != getseqKey) {
+            continue;
+        }
+        std::string lseq = lseqIt->value().ToString();
+        status = dbs[LSEQ]->Get(view[LSEQ], lseq, &record);
+        if (status.ok() && !LogRecord::decode(record, indexedKey, value)) {
+            status = leveldb::Status::Corruption("malformed log record");
+        }
+        //Removal points the index to an lseq without log record
+        if (status.IsNotFound() || (status.ok() && indexedKey != realKey)) {
+            status = leveldb::Status::OK();
+            continue;
+        }
+        if (!status.ok()) {
+            break;
+        }
+        res.push_back({std::move(lseq), std::move(realKey), value.ToString()});
+    }
+    if (status.ok())
+        status = lseqIt->status();
+    if (!status.ok()) {
+        return {{}, status};
+    }
+    return {res, status};
 }
 
 //UNSAFE, this method can override existing value
 //Should never be called with unchecked value
 //Argument should contain precise keys from another replica
 leveldb::Status dbConnector::putBatch(const batchValues& keyValuePairs) {
-    leveldb::WriteBatch batch;
+    NamespaceBatches batches;
     for (const auto& [lseq, key, value] : keyValuePairs) {
-        batch.Put(lseq, key);
-        batch.Put(key, value);
-        batch.Put(generateGetseqKey(key), lseq);
-        int replicaId = std::stoi(lseqToReplicaId(lseq));
+        if (!isLseqKey(lseq) || key.size() < FullKey::kReplicaIdLength) {
+            return leveldb::Status::InvalidArgument("malformed batch item");
+        }
+        batches[LSEQ].Put(lseq, LogRecord::encode(key, value));
+        batches[VALUES].Put(key, value);
+        batches[GETSEQ].Put(generateGetseqKey(key), lseq);
+        int replicaId = lseqToReplicaId(lseq);
         leveldb::SequenceNumber seq = lseqToSeq(lseq);
-        batch.Put(FullKey(stampedKeyToRealKey(key), seq, replicaId).getFullKey(), value);
+        batches[HISTORY].Put(FullKey(stampedKeyToRealKey(key), seq, replicaId).getFullKey(), value);
         updateReplicaId(seq, replicaId);
     }
-    leveldb::Status s = db->Write(leveldb::WriteOptions(), &batch);
+    //Replicated writes can be fetched again, so only the always mode makes them wait for disk
+    leveldb::WriteOptions options;
+    options.sync = defaultDurability == Durability::ALWAYS;
+    leveldb::Status s;
+    {
+        std::lock_guard<std::mutex> lock(applyMutex);
+        for (const auto& item : keyValuePairs) {
+            markWritten(batches, lseqToReplicaId(item.lseq), lseqToSeq(item.lseq));
+        }
+        s = writeNamespaces(batches, options);
+        for (const auto& [lseq, key, value] : keyValuePairs) {
+            if (s.ok()) {
+                valueCache->update(key, {lseq, value});
+            } else {
+                valueCache->erase(key);
+            }
+        }
+        if (s.ok()) {
+            eventRing->publish(keyValuePairs);
+        }
+    }
+    if (s.ok()) {
+        notifyWriteListener();
+    }
     return s;
 }
 
@@ -179,71 +800,162 @@ replyBatchFormat dbConnector::getByLseq(leveldb::SequenceNumber seq, int id, int
 }
 
 replyBatchFormat dbConnector::getValuesForKey(const std::string& key, leveldb::SequenceNumber seq, int id, int limit, LSEQ_COMPARE isGreater) {
+    return drain(*keyCursor(key, seq, id, isGreater), limit);
+}
+
+replyBatchFormat dbConnector::getAllValuesForKey(const std::string& key, int id, int limit, LSEQ_COMPARE isGreater) {
+    return getValuesForKey(key, 0, id, limit, isGreater);
+}
+
+//Latest values of replica id with start <= key < end, in key order. Empty end means no upper bound
+replyBatchFormat dbConnector::getRange(const std::string& start, const std::string& end, int id, int limit) {
     batchValues res;
-    int cnt = -1;
-    leveldb::ReadOptions options;
-    options.snapshot = db->GetSnapshot();
-    std::unique_ptr<leveldb::Iterator> it(db->NewIterator(options));
-    FullKey searchValue = (isGreater == LSEQ_COMPARE::GREATER ? FullKey(key, seq + 1, id) : FullKey(key, seq, id));
-    for (it->Seek(searchValue.getFullKey());
-         it->Valid() && cnt <= limit;
+    ReadView view = acquireReadView();
+    std::unique_ptr<leveldb::Iterator> it(dbs[VALUES]->NewIterator(view[VALUES]));
+    std::unique_ptr<leveldb::Iterator> lseqIt(dbs[GETSEQ]->NewIterator(view[GETSEQ]));
+    const std::string upper = end.empty() ? idToString(id + 1) : generateNormalKey(end, id);
+    std::string lseqKey;
+    for (it->Seek(generateNormalKey(start, id));
+         it->Valid() && it->key().compare(upper) < 0 && (limit == -1 || static_cast<int>(res.size()) < limit);
          it->Next())
     {
-        FullKey currentKey(it->key().ToString());
-        if (currentKey.getKey() != key)
-            break;
-        int replicaId = currentKey.getReplicaId();
-        if (limit != -1)
-            ++cnt;
-        res.push_back({generateLseqKey(currentKey.getSeq(), replicaId), generateNormalKey(key, replicaId), it->value().ToString()});
+        //'@' index holds the same keys in the same order (plus removed ones), so it is merged, not looked up
+        lseqKey.assign("@");
+        lseqKey.append(it->key().data(), it->key().size());
+        if (!lseqIt->Valid()) {
+            lseqIt->Seek(lseqKey);
+        }
+        while (lseqIt->Valid() && lseqIt->key().compare(lseqKey) < 0) {
+            lseqIt->Next();
+        }
+        if (!lseqIt->Valid() || lseqIt->key() != lseqKey) {
+            //Value is written, but its index is not yet
+            continue;
+        }
+        res.push_back({lseqIt->value().ToString(), it->key().ToString(), it->value().ToString()});
     }
     leveldb::Status status = it->status();
-    db->ReleaseSnapshot(options.snapshot);
+    if (status.ok())
+        status = lseqIt->status();
     return {res, status};
 }
 
-replyBatchFormat dbConnector::getAllValuesForKey(const std::string& key, int id, int limit, LSEQ_COMPARE isGreater) {
-    return getValuesForKey(key, 0, id, limit, isGreater);
+replyBatchFormat dbConnector::getPrefix(const std::string& prefix, int id, int limit) {
+    //Smallest key greater than every key with the prefix, empty if there is none
+    std::string end = prefix;
+    while (!end.empty() && static_cast<unsigned char>(end.back()) == 0xff)
+        end.pop_back();
+    if (!end.empty())
+        ++end.back();
+    return getRange(prefix, end, id, limit);
 }
 
 replyBatchFormat dbConnector::getByLseq(std::string lseq, int limit, LSEQ_COMPARE isGreater) {
-    batchValues res;
-    int cnt = -1;
-    leveldb::ReadOptions options;
-    options.snapshot = db->GetSnapshot();
-    std::unique_ptr<leveldb::Iterator> it(db->NewIterator(options));
+    if (!isLseqKey(lseq)) {
+        return {{}, leveldb::Status::InvalidArgument("malformed lseq")};
+    }
+    return drain(*logCursor(std::move(lseq), isGreater), limit);
+}
+
+std::unique_ptr<dbConnector::EventCursor> dbConnector::logCursor(std::string lseq, LSEQ_COMPARE isGreater) {
+    int replicaId = isLseqKey(lseq) ? lseqToReplicaId(lseq) : 0;
+    std::unique_ptr<EventCursor> cursor(new EventCursor(acquireReadView(), dbs[LSEQ], LSEQ, "", replicaId));
+    if (!isLseqKey(lseq)) {
+        cursor->st = leveldb::Status::InvalidArgument("malformed lseq");
+        return cursor;
+    }
     if (isGreater == LSEQ_COMPARE::GREATER)
-        lseq = generateLseqKey(lseqToSeq(lseq) + 1, std::stoi(lseqToReplicaId(lseq)));
-    for (it->Seek(lseq);
-         it->Valid() && cnt <= limit;
-         it->Next())
-    {
-        if (!(lseqToReplicaId(it->key().ToString()) == lseqToReplicaId(lseq))) {
+        lseq = generateLseqKey(lseqToSeq(lseq) + 1, replicaId);
+    cursor->it->Seek(lseq);
+    return cursor;
+}
+
+std::unique_ptr<dbConnector::EventCursor> dbConnector::keyCursor(const std::string& key, leveldb::SequenceNumber seq, int id, LSEQ_COMPARE isGreater) {
+    std::unique_ptr<EventCursor> cursor(new EventCursor(acquireReadView(), dbs[HISTORY], HISTORY, key, id));
+    std::string start = FullKey(key, seq, id).getFullKey();
+    cursor->it->Seek(start);
+    //Versions are ordered by seq and then replica id, so the one right after (seq, id) is the exact successor
+    if (isGreater == LSEQ_COMPARE::GREATER && cursor->it->Valid() && cursor->it->key() == start)
+        cursor->it->Next();
+    return cursor;
+}
+
+replyBatchFormat dbConnector::drain(EventCursor& cursor, int limit) {
+    batchValues res;
+    //These reads have always let limit + 2 items through and callers rely on it; cursors count exactly
+    size_t maxItems = limit == -1 ? std::numeric_limits<size_t>::max() : static_cast<size_t>(limit) + 2;
+    cursor.next(res, maxItems, std::numeric_limits<size_t>::max());
+    return {res, cursor.status()};
+}
+
+dbConnector::EventCursor::EventCursor(ReadView view, leveldb::DB* db, KeyNamespace ns, std::string key, int replicaId)
+    : view(std::move(view)), source(ns), key(std::move(key)), replicaId(replicaId) {
+    it.reset(db->NewIterator(this->view[ns]));
+}
+
+bool dbConnector::EventCursor::inRange() const {
+    if (!it->Valid())
+        return false;
+    if (source == LSEQ) {
+        //Lseq keys of the next replica follow
+        return isLseqKey(it->key()) && lseqToReplicaId(it->key()) == replicaId;
+    }
+    FullKeyView currentKey(it->key());
+    return currentKey.isValid() && currentKey.getKey() == key;
+}
+
+bool dbConnector::EventCursor::current(batchValue& item) {
+    if (!inRange())
+        return false;
+    if (source == LSEQ) {
+        //Log records carry their values, so the log is read by a single sequential scan
+        leveldb::Slice stampedKey;
+        leveldb::Slice value;
+        if (!LogRecord::decode(it->value(), stampedKey, value)) {
+            st = leveldb::Status::Corruption("malformed log record");
+            return false;
+        }
+        item = {it->key().ToString(), stampedKey.ToString(), value.ToString()};
+        return true;
+    }
+    FullKeyView currentKey(it->key());
+    int id = currentKey.getReplicaId();
+    item = {generateLseqKey(currentKey.getSeq(), id), generateNormalKey(key, id), it->value().ToString()};
+    return true;
+}
+
+bool dbConnector::EventCursor::next(batchValues& out, size_t maxItems, size_t maxBytes, std::chrono::steady_clock::time_point deadline) {
+    expired = false;
+    size_t bytes = 0;
+    batchValue item;
+    for (size_t added = 0; added < maxItems; ++added) {
+        if (!st.ok() || !current(item)) {
             break;
         }
-        if (limit != -1)
-            ++cnt;
-        int replicaId = std::stoi(lseqToReplicaId(it->key().ToString()));
-        std::string realKey = FullKey(stampedKeyToRealKey(it->value().ToString()), lseqToSeq(it->key().ToString()), replicaId).getFullKey();
-        std::string realValue;
-        auto s = db->Get(options, realKey, &realValue);
-        if (!s.ok()) {
-            db->ReleaseSnapshot(options.snapshot);
-            return {res, s};
+        bytes += item.key.size() + item.value.size();
+        token = item.lseq;
+        out.push_back(std::move(item));
+        it->Next();
+        if (bytes >= maxBytes) {
+            break;
+        }
+        if (deadline != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= deadline) {
+            expired = true;
+            break;
         }
-        res.push_back({it->key().ToString(), it->value().ToString(), realValue});
     }
-    leveldb::Status status = it->status();
-    db->ReleaseSnapshot(options.snapshot);
-    return {res, status};
+    if (st.ok())
+        st = it->status();
+    return st.ok() && inRange();
 }
 
 std::string dbConnector::generateLseqKey(leveldb::SequenceNumber seq, int id) {
-    std::stringstream stringSeq;
-    stringSeq << std::setw(FullKey::kSeqNumberLength) << std::setfill('0') << seq;
-    std::string lseqNumber = idToString(id);
-    lseqNumber[0] = '#';
-    return lseqNumber + stringSeq.str();
+    std::string lseq;
+    lseq.reserve(kLseqKeyLength);
+    lseq.push_back('#');
+    KeyCoding::appendFixed32(lseq, static_cast<uint32_t>(id));
+    KeyCoding::appendFixed64(lseq, seq);
+    return lseq;
 }
 
 std::string dbConnector::stampedKeyToRealKey(const std::string& stampedKey) {
@@ -255,19 +967,23 @@ std::string dbConnector::generateNormalKey(const std::string& key, int id) {
 }
 
 std::string dbConnector::idToString(int id) {
-    std::stringstream ss;
-    ss << std::setw(FullKey::kReplicaIdLength) << std::setfill('0') << id;
-    return ss.str();
+    std::string res;
+    KeyCoding::appendFixed32(res, static_cast<uint32_t>(id));
+    return res;
 }
 
 std::string dbConnector::generateGetseqKey(const std::string& realKey) {
-    return std::string("@") + realKey.substr(1);
+    return std::string("@") + realKey;
 }
 
-std::string dbConnector::lseqToReplicaId(const std::string& lseq) {
-    return lseq.substr(1, 9);
+int dbConnector::lseqToReplicaId(const leveldb::Slice& lseq) {
+    return static_cast<int>(KeyCoding::decodeFixed32(lseq.data() + 1));
 }
 
-leveldb::SequenceNumber dbConnector::lseqToSeq(const std::string& lseq) {
-    return std::stoll(lseq.substr(FullKey::kReplicaIdLength));
-}
\ No newline at end of file
+leveldb::SequenceNumber dbConnector::lseqToSeq(const leveldb::Slice& lseq) {
+    return KeyCoding::decodeFixed64(lseq.data() + 1 + FullKey::kReplicaIdLength);
+}
+
+bool dbConnector::isLseqKey(const leveldb::Slice& lseq) {
+    return lseq.size() == kLseqKeyLength && lseq[0] == '#';
+}
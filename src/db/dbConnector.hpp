@@ -1,13 +1,30 @@
 #pragma once
 
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "leveldb/cache.h"
 #include "leveldb/db.h"
+#include "leveldb/filter_policy.h"
+#include "leveldb/write_batch.h"
+#include "src/db/eventRing.hpp"
+#include "src/db/hotKeys.hpp"
+#include "src/db/seqTimeline.hpp"
+#include "src/db/snapshotManager.hpp"
+#include "src/db/valueCache.hpp"
 #include "src/utils/yamlConfig.hpp"
-#include "src/db/comparator.hpp"
 
 using lseqType = std::string;
 using keyType = std::string;
@@ -42,22 +59,36 @@ public:
 
     enum class LSEQ_COMPARE {GREATER_EQUAL, GREATER};
 
+    class EventCursor;
+
     explicit dbConnector(const YAMLConfig& config);
 
     dbConnector(const dbConnector&) = delete;
 
     dbConnector(dbConnector&&) = delete;
 
-    replyFormat put(std::string key, std::string value);
+    ~dbConnector();
+
+    //Durability defaults to the one from storage config
+    replyFormat put(std::string key, std::string value, std::optional<Durability> durability = std::nullopt);
 
-    replyFormat remove(std::string key);
+    replyFormat remove(std::string key, std::optional<Durability> durability = std::nullopt);
 
     pureReplyValue get(std::string key);
 
     pureReplyValue get(std::string key, int id);
 
+    //Latest values of the given keys of replica id, in key order. Keys without a value are left out
+    replyBatchFormat multiGet(std::vector<std::string> keys, int id);
+
     leveldb::Status putBatch(const batchValues& keyValuePairs);
 
+    //Log events of the replica of lseq, in lseq order
+    std::unique_ptr<EventCursor> logCursor(std::string lseq, LSEQ_COMPARE isGreater = LSEQ_COMPARE::GREATER_EQUAL);
+
+    //Versions of key from every replica, in (seq, replica id) order starting at (seq, id)
+    std::unique_ptr<EventCursor> keyCursor(const std::string& key, leveldb::SequenceNumber seq, int id, LSEQ_COMPARE isGreater = LSEQ_COMPARE::GREATER_EQUAL);
+
     replyBatchFormat getByLseq(leveldb::SequenceNumber seq, int id, int limit = -1, LSEQ_COMPARE isGreater = LSEQ_COMPARE::GREATER_EQUAL);
 
     replyBatchFormat getByLseq(std::string lseq, int limit = -1, LSEQ_COMPARE isGreater = LSEQ_COMPARE::GREATER_EQUAL);
@@ -66,32 +97,254 @@ public:
 
     replyBatchFormat getAllValuesForKey(const std::string& key, int id, int limit = -1, LSEQ_COMPARE isGreater = LSEQ_COMPARE::GREATER_EQUAL);
 
+    replyBatchFormat getRange(const std::string& start, const std::string& end, int id, int limit = -1);
+
+    replyBatchFormat getPrefix(const std::string& prefix, int id, int limit = -1);
+
     leveldb::SequenceNumber sequenceNumberForReplica(int id);
 
+    ValueCache::Stats valueCacheStats() const;
+
+    //Log events of every replica in the order they are committed, for readers following new writes
+    EventRing<batchValue>& recentEvents();
+
+    //Runs one retention pass over the whole history now, as the background collector does every interval.
+    //Expired versions leave history and the lseq log together. Does nothing when everything is retained
+    leveldb::Status collectHistory();
+
+    //Set once the keys saved by the previous run have been read back, which happens in the background after start
+    bool warmedUp() const;
+
+    //Called from the writing thread after every successful put, remove and putBatch, once sequenceNumberForReplica
+    //covers the write. Must be cheap, writes wait for it. Replaces the previous listener, an empty one removes it
+    void setWriteListener(std::function<void()> listener);
+
     static std::string generateLseqKey(leveldb::SequenceNumber seq, int id);
 
     static std::string stampedKeyToRealKey(const std::string& stampedKey);
 
     static std::string generateNormalKey(const std::string& key, int id);
 
-    static std::string lseqToReplicaId(const std::string& lseq);
+    static int lseqToReplicaId(const leveldb::Slice& lseq);
+
+    static leveldb::SequenceNumber lseqToSeq(const leveldb::Slice& lseq);
 
-    static leveldb::SequenceNumber lseqToSeq(const std::string& lseq);
+    static bool isLseqKey(const leveldb::Slice& lseq);
 
 protected:
     static std::string idToString(int id);
 
     static std::string generateGetseqKey(const std::string& realKey);
 
+    //Seq of the last log record of replica id
     leveldb::SequenceNumber getMaxSeqForReplica(int id);
 
+    //Sets seqCount from the stored marks, checked against the last log record of every replica
+    leveldb::Status loadSeqMarks(int maxReplicaId);
+
     void updateReplicaId(leveldb::SequenceNumber seq, size_t replicaId);
 
+    //Every namespace lives in its own database when split, otherwise all of them alias the values database
+    enum KeyNamespace { VALUES, GETSEQ, LSEQ, HISTORY, NAMESPACE_COUNT };
+
+    using NamespaceBatches = std::array<leveldb::WriteBatch, NAMESPACE_COUNT>;
+
+    //Read options with one snapshot per database, valid while the view is alive
+    struct ReadView {
+        std::shared_ptr<const SnapshotManager::SnapshotSet> snapshots;
+        std::array<leveldb::ReadOptions, NAMESPACE_COUNT> options;
+
+        const leveldb::ReadOptions& operator[](KeyNamespace ns) const {
+            return options[ns];
+        }
+    };
+
+    //Split databases are written one by one in the order values, history, lseq log, getseq index,
+    //so a record found through an index is always visible in the namespaces written before it.
+    //Without split all batches go in a single write
+    leveldb::Status writeNamespaces(NamespaceBatches& batches, const leveldb::WriteOptions& options);
+
+    //Forces the log of every database to disk
+    leveldb::Status syncDatabases();
+
+    //Snapshots are taken in reverse write order, which keeps the guarantee above for readers.
+    //Concurrent readers share them, see SnapshotManager
+    ReadView acquireReadView();
+
+    leveldb::Options namespaceOptions(const StorageConfig& storage, KeyNamespace ns);
+
+    leveldb::Status repairGetseqIndex(int maxReplicaId);
+
+    //Adds the new mark of replica id to batches if seq raises it. Caller holds applyMutex
+    void markWritten(NamespaceBatches& batches, int id, leveldb::SequenceNumber seq);
+
+    //Reads everything for limit -1
+    static replyBatchFormat drain(EventCursor& cursor, int limit);
+
+    //Local put or remove waiting in the group commit queue
+    struct PendingWrite {
+        bool isRemove;
+        std::string key;
+        std::string value;
+        Durability durability;
+        std::promise<replyFormat> done;
+    };
+
+    replyFormat submitWrite(PendingWrite& write);
+
+    void writerLoop();
+
+    void commitGroup(std::vector<PendingWrite*>& group);
+
+    void syncLoop();
+
+    //History version of a key as seen by the collector
+    struct Version {
+        leveldb::SequenceNumber seq;
+        int id;
+    };
+
+    //Samples seqCount into the timeline and stores it when a sample was added
+    leveldb::Status sampleTimeline(int64_t nowMillis);
+
+    //Collects whole keys from resume on until a chunk of records is read, then moves resume to the next key.
+    //Done once history is exhausted
+    leveldb::Status collectHistoryChunk(std::string& resume, const std::vector<leveldb::SequenceNumber>& covered, bool& done);
+
+    //Adds deletions of expired versions of key to batches. Versions come in (seq, replica id) order
+    leveldb::Status expireVersions(const std::string& key, std::vector<Version>& versions,
+                                   const std::vector<leveldb::SequenceNumber>& covered, NamespaceBatches& batches, size_t& expired);
+
+    void collectorLoop();
+
+    //Reads back the saved hot keys, then saves them every warmup interval
+    void warmupLoop();
+
+    leveldb::Status saveHotKeys();
+
+    void notifyWriteListener();
+
 private:
     static_assert(std::is_same_v<leveldb::SequenceNumber, uint64_t>, "Refusing to build with different underlying sequence number");
     std::vector<std::atomic<leveldb::SequenceNumber>> seqCount;
-    std::unique_ptr<leveldb::DB> db;
+    //Declared before databases: LevelDB uses policy and caches until the database is closed
+    std::unique_ptr<const leveldb::FilterPolicy> filterPolicy;
+    std::array<std::unique_ptr<leveldb::Cache>, NAMESPACE_COUNT> blockCaches;
+    std::array<std::unique_ptr<leveldb::DB>, NAMESPACE_COUNT> ownedDbs;
+    std::array<leveldb::DB*, NAMESPACE_COUNT> dbs{};
+    bool splitNamespaces = false;
+    std::unique_ptr<SnapshotManager> snapshotManager;
+    //Position of the namespace database in snapshot sets
+    std::array<size_t, NAMESPACE_COUNT> snapshotIndex{};
+    std::unique_ptr<ValueCache> valueCache;
+    std::unique_ptr<EventRing<batchValue>> eventRing;
+    //Held by local and replicated writes from their database write until the value cache and the event ring
+    //are updated, so both see writes in the same order as the databases
+    std::mutex applyMutex;
+    //Highest seq of every replica written so far, guarded by applyMutex. Each write stores the marks it raises
+    //in its lseq log batch, so a restart reads them instead of scanning the log. Unlike the log they count removals
+    std::vector<leveldb::SequenceNumber> seqMarks;
+
+    std::mutex listenerMutex;
+    std::function<void()> writeListener;
+
+    //Local writes are committed by a single writer thread, which combines all queued writes into one batch
+    //with consecutive lseqs. Writes become visible in lseq order, so replicas reading the log never skip a gap
+    std::chrono::microseconds groupCommitWindow{0};
+    size_t groupCommitMaxBytes = 0;
+    std::mutex writeMutex;
+    std::condition_variable writeReady;
+    std::deque<PendingWrite*> writeQueue;
+    size_t queuedBytes = 0;
+    bool stopWriter = false;
+    //Owned by the writer thread once it is started
+    leveldb::SequenceNumber lastLocalSeq = 0;
+    std::thread writerThread;
+
+    //Applied periodic writes are acknowledged by the syncer thread once a sync covers them
+    Durability defaultDurability = Durability::NONE;
+    std::chrono::milliseconds syncInterval{0};
+    size_t syncBytes = 0;
+    std::mutex syncMutex;
+    std::condition_variable syncNeeded;
+    std::vector<std::pair<PendingWrite*, replyFormat>> syncWaiters;
+    size_t unsyncedBytes = 0;
+    bool stopSyncer = false;
+    std::thread syncerThread;
+
+    //History collector thread runs only when retention has a limit. Age of versions is taken from the timeline,
+    //which is persisted, so versions keep aging across restarts
+    size_t retainVersions = 0;
+    std::chrono::milliseconds retainAge{0};
+    size_t gcChunkRecords = 0;
+    std::chrono::milliseconds gcPause{0};
+    std::chrono::milliseconds gcInterval{0};
+    //Held for a whole pass, guards the timeline
+    std::mutex collectMutex;
+    SeqTimeline timeline;
+    std::mutex gcMutex;
+    std::condition_variable gcWake;
+    bool stopGc = false;
+    std::thread gcThread;
+
+    //Reads are sampled only when warmup is on
+    std::unique_ptr<HotKeys> hotKeys;
+    std::string warmupFile;
+    std::chrono::seconds warmupInterval{0};
+    std::atomic<bool> warm{false};
+    std::mutex warmupMutex;
+    std::condition_variable warmupWake;
+    bool stopWarmup = false;
+    std::thread warmupThread;
 
     int selfId;
 
+};
+
+//Reads events incrementally under one read view, so a long read never holds its whole result.
+//Must not outlive the dbConnector it came from
+class dbConnector::EventCursor {
+public:
+    EventCursor(const EventCursor&) = delete;
+
+    //Appends up to maxItems items to out, stopping early once the added keys and values reach maxBytes
+    //or the deadline passes. False once no items are left or reading failed, see status
+    bool next(batchValues& out, size_t maxItems, size_t maxBytes,
+              std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max());
+
+    const leveldb::Status& status() const {
+        return st;
+    }
+
+    //Set when the last next stopped because of its deadline
+    bool timedOut() const {
+        return expired;
+    }
+
+    //Lseq of the last item returned, empty before the first one.
+    //A cursor of the same kind started after it with GREATER continues this one
+    const std::string& resumeToken() const {
+        return token;
+    }
+
+private:
+    friend class dbConnector;
+
+    EventCursor(ReadView view, leveldb::DB* db, KeyNamespace ns, std::string key, int replicaId);
+
+    bool inRange() const;
+
+    //Parses the current position, false when it is past the cursor range
+    bool current(batchValue& item);
+
+    //Declared before the iterator, which has to be released first
+    ReadView view;
+    std::unique_ptr<leveldb::Iterator> it;
+    //LSEQ reads one replica log, HISTORY versions of one key
+    KeyNamespace source;
+    std::string key;
+    int replicaId;
+    std::string token;
+    leveldb::Status st;
+    bool expired = false;
 };
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Most recent committed events, shared by every reader that follows new commits.
+// Each event gets the next position; the oldest ones are overwritten once capacity is reached,
+// so a reader that fell behind learns it missed events and has to read them elsewhere
+template<class Event>
+class EventRing {
+public:
+    using EventPtr = std::shared_ptr<const Event>;
+
+    explicit EventRing(size_t capacity) : slots(capacity) {}
+
+    EventRing(const EventRing&) = delete;
+
+    //Position of the next published event
+    uint64_t end() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return next;
+    }
+
+    void publish(const std::vector<Event>& events) {
+        if (events.empty()) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (const auto& event : events) {
+                slots[next % slots.size()] = std::make_shared<const Event>(event);
+                ++next;
+            }
+        }
+        published.notify_all();
+    }
+
+    //Appends up to maxEvents events from pos on and moves pos past them, waiting for the first one until deadline.
+    //False if events at pos were already overwritten
+    bool read(uint64_t& pos, std::vector<EventPtr>& out, size_t maxEvents, std::chrono::steady_clock::time_point deadline) {
+        std::unique_lock<std::mutex> lock(mutex);
+        published.wait_until(lock, deadline, [&] { return closed || next > pos; });
+        if (next - pos > slots.size()) {
+            return false;
+        }
+        for (; pos < next && maxEvents > 0; ++pos, --maxEvents) {
+            out.push_back(slots[pos % slots.size()]);
+        }
+        return true;
+    }
+
+    //Wakes every reader, later reads return at once
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+        }
+        published.notify_all();
+    }
+
+    bool isClosed() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return closed;
+    }
+
+private:
+    mutable std::mutex mutex;
+    std::condition_variable published;
+    std::vector<EventPtr> slots;
+    uint64_t next = 0;
+    bool closed = false;
+};
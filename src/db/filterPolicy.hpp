@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "leveldb/db.h"
+#include "leveldb/filter_policy.h"
+#include "src/db/fullKey.hpp"
+
+// Bloom filter over the key namespaces of dbConnector.
+// Normal, '@' and '#' keys are only ever read by exact key, so they are hashed whole.
+// '!' history keys are hashed without their seq and replica id suffix: a probe for any version of a key
+// then answers "does this table hold the key at all", and a table keeps one filter entry per key instead of one per version.
+// Note that LevelDB consults filters on Get only; iterator seeks always visit every overlapping table
+class NamespaceFilterPolicy : public leveldb::FilterPolicy {
+public:
+    explicit NamespaceFilterPolicy(int bitsPerKey) : bloom(leveldb::NewBloomFilterPolicy(bitsPerKey)) {}
+
+    //Stored in every table; changing the hashed key portion requires a new name
+    const char* Name() const override {
+        return "lseqdb.NamespaceBloomFilter";
+    }
+
+    void CreateFilter(const leveldb::Slice* keys, int n, std::string* dst) const override {
+        std::vector<leveldb::Slice> filterKeys;
+        filterKeys.reserve(n);
+        for (int i = 0; i < n; ++i) {
+            leveldb::Slice key = filterKey(keys[i]);
+            //Keys arrive sorted, so versions of one history key are adjacent
+            if (filterKeys.empty() || filterKeys.back() != key) {
+                filterKeys.push_back(key);
+            }
+        }
+        bloom->CreateFilter(filterKeys.data(), static_cast<int>(filterKeys.size()), dst);
+    }
+
+    bool KeyMayMatch(const leveldb::Slice& key, const leveldb::Slice& filter) const override {
+        return bloom->KeyMayMatch(filterKey(key), filter);
+    }
+
+    static leveldb::Slice filterKey(const leveldb::Slice& key) {
+        if (FullKeyView(key).isValid()) {
+            return {key.data(), key.size() - FullKey::kSeqNumberLength - FullKey::kReplicaIdLength};
+        }
+        return key;
+    }
+
+private:
+    std::unique_ptr<const leveldb::FilterPolicy> bloom;
+};
@@ -1,30 +1,41 @@
 #pragma once
 
-#include <iomanip>
-#include <sstream>
 #include <string>
 
 #include "leveldb/db.h"
+#include "src/db/keyCoding.hpp"
 
+// Layout: '!' + big-endian key length (4 bytes) + key + big-endian seq (8 bytes) + big-endian replica id (4 bytes).
+// Length prefix keeps all versions of one key contiguous under bytewise order
 class FullKey {
 public:
-    static constexpr int kSeqNumberLength = 15;
-    static constexpr int kReplicaIdLength = 10;
+    static constexpr int kKeyLengthLength = 4;
+    static constexpr int kSeqNumberLength = 8;
+    static constexpr int kReplicaIdLength = 4;
+    static constexpr int kOverhead = 1 + kKeyLengthLength + kSeqNumberLength + kReplicaIdLength;
 
     FullKey(const std::string& fullKey) : key(fullKey) {
-        keyLength = static_cast<int>(fullKey.size()) - 1 - kReplicaIdLength - kSeqNumberLength;
-        raw_key = key.substr(1, keyLength);
+        keyLength = static_cast<int>(fullKey.size()) - kOverhead;
+        raw_key = key.substr(1 + kKeyLengthLength, keyLength);
     }
 
     FullKey(const std::string& key, leveldb::SequenceNumber seq, int id) {
-        std::stringstream ss;
-        ss << std::setw(kSeqNumberLength) << std::setfill('0') << seq;
-        ss << std::setw(kReplicaIdLength) << std::setfill('0') << id;
-        this->key = std::string("!") + key + ss.str();
+        encode(this->key, key, seq, id);
         keyLength = key.size();
         raw_key = key;
     }
 
+    //Overwrites dst, so the same buffer can be reused between iterations
+    static void encode(std::string& dst, const leveldb::Slice& key, leveldb::SequenceNumber seq, int id) {
+        dst.clear();
+        dst.reserve(kOverhead + key.size());
+        dst.push_back('!');
+        KeyCoding::appendFixed32(dst, static_cast<uint32_t>(key.size()));
+        dst.append(key.data(), key.size());
+        KeyCoding::appendFixed64(dst, seq);
+        KeyCoding::appendFixed32(dst, static_cast<uint32_t>(id));
+    }
+
     const std::string& getFullKey() const {
         return key;
     }
@@ -34,11 +45,11 @@ public:
     }
 
     leveldb::SequenceNumber getSeq() const {
-        return std::stoll(key.substr(1 + keyLength, kSeqNumberLength));
+        return KeyCoding::decodeFixed64(key.data() + 1 + kKeyLengthLength + keyLength);
     }
 
     int getReplicaId() const {
-        return std::stoi(key.substr(1 + keyLength + kSeqNumberLength));
+        return static_cast<int>(KeyCoding::decodeFixed32(key.data() + 1 + kKeyLengthLength + keyLength + kSeqNumberLength));
     }
 
 private:
@@ -46,3 +57,34 @@ private:
     std::string raw_key;
     int keyLength;
 };
+
+//Non-owning counterpart of FullKey for iteration: parses in place, never allocates.
+//Viewed data must outlive the view, for iterator keys it is valid until the next move
+class FullKeyView {
+public:
+    explicit FullKeyView(const leveldb::Slice& fullKey) : key(fullKey) {}
+
+    bool isValid() const {
+        return key.size() >= FullKey::kOverhead && key[0] == '!' &&
+               KeyCoding::decodeFixed32(key.data() + 1) == key.size() - FullKey::kOverhead;
+    }
+
+    leveldb::Slice getKey() const {
+        return {key.data() + 1 + FullKey::kKeyLengthLength, keyLength()};
+    }
+
+    leveldb::SequenceNumber getSeq() const {
+        return KeyCoding::decodeFixed64(key.data() + 1 + FullKey::kKeyLengthLength + keyLength());
+    }
+
+    int getReplicaId() const {
+        return static_cast<int>(KeyCoding::decodeFixed32(key.data() + 1 + FullKey::kKeyLengthLength + keyLength() + FullKey::kSeqNumberLength));
+    }
+
+private:
+    size_t keyLength() const {
+        return key.size() - FullKey::kOverhead;
+    }
+
+    leveldb::Slice key;
+};
@@ -0,0 +1,99 @@
+#include "hotKeys.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <unordered_set>
+
+#include "src/db/keyCoding.hpp"
+
+namespace {
+    const std::string kTempSuffix = ".tmp";
+}
+
+HotKeys::HotKeys(size_t capacity, uint32_t sampleEvery) : sampleEvery(sampleEvery > 0 ? sampleEvery : 1) {
+    samples.resize(capacity);
+}
+
+void HotKeys::record(const std::string& key) {
+    if (samples.empty() || reads.fetch_add(1, std::memory_order_relaxed) % sampleEvery != 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    samples[next] = key;
+    next = (next + 1) % samples.size();
+}
+
+void HotKeys::seed(const std::vector<std::string>& keys) {
+    std::lock_guard<std::mutex> lock(mutex);
+    size_t count = std::min(keys.size(), samples.size());
+    //Most recent key goes last, so it is the last to be replaced
+    for (size_t i = count; i > 0; --i) {
+        samples[next] = keys[i - 1];
+        next = (next + 1) % samples.size();
+    }
+}
+
+std::vector<std::string> HotKeys::keys() const {
+    std::vector<std::string> res;
+    std::unordered_set<std::string> seen;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (size_t i = 1; i <= samples.size(); ++i) {
+        const std::string& key = samples[(next + samples.size() - i) % samples.size()];
+        if (!key.empty() && seen.insert(key).second) {
+            res.push_back(key);
+        }
+    }
+    return res;
+}
+
+// Layout: key count (4 bytes), then every key prefixed by its length (4 bytes), big-endian
+leveldb::Status HotKeys::save(const std::string& path, const std::vector<std::string>& keys) {
+    std::string data;
+    KeyCoding::appendFixed32(data, static_cast<uint32_t>(keys.size()));
+    for (const auto& key : keys) {
+        KeyCoding::appendFixed32(data, static_cast<uint32_t>(key.size()));
+        data.append(key);
+    }
+    {
+        std::ofstream out(path + kTempSuffix, std::ios::binary | std::ios::trunc);
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+        if (!out.flush()) {
+            return leveldb::Status::IOError(path + kTempSuffix, "write failed");
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(path + kTempSuffix, path, error);
+    if (error) {
+        return leveldb::Status::IOError(path, error.message());
+    }
+    return leveldb::Status::OK();
+}
+
+leveldb::Status HotKeys::load(const std::string& path, std::vector<std::string>& keys) {
+    keys.clear();
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        return leveldb::Status::OK();
+    }
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    size_t pos = 4;
+    if (data.size() < pos) {
+        return leveldb::Status::Corruption(path, "truncated manifest");
+    }
+    uint32_t count = KeyCoding::decodeFixed32(data.data());
+    for (uint32_t i = 0; i < count; ++i) {
+        if (data.size() - pos < 4) {
+            return leveldb::Status::Corruption(path, "truncated manifest");
+        }
+        uint32_t length = KeyCoding::decodeFixed32(data.data() + pos);
+        pos += 4;
+        if (data.size() - pos < length) {
+            return leveldb::Status::Corruption(path, "truncated manifest");
+        }
+        keys.push_back(data.substr(pos, length));
+        pos += length;
+    }
+    return leveldb::Status::OK();
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "leveldb/status.h"
+
+// Keys of recent reads, one read in sampleEvery is sampled, so the read path stays cheap.
+// Newest samples replace the oldest ones. The hot keys are saved to a manifest file
+// and read back on the next start to warm up the caches
+class HotKeys {
+public:
+    //Capacity 0 disables sampling
+    HotKeys(size_t capacity, uint32_t sampleEvery);
+
+    HotKeys(const HotKeys&) = delete;
+
+    void record(const std::string& key);
+
+    //Takes the keys of a loaded manifest as the oldest samples
+    void seed(const std::vector<std::string>& keys);
+
+    //Distinct sampled keys, most recent first
+    std::vector<std::string> keys() const;
+
+    //Replaces the file at once, so a crash while saving leaves the previous manifest
+    static leveldb::Status save(const std::string& path, const std::vector<std::string>& keys);
+
+    //A missing manifest loads no keys
+    static leveldb::Status load(const std::string& path, std::vector<std::string>& keys);
+
+private:
+    const uint32_t sampleEvery;
+    std::atomic<uint32_t> reads{0};
+    mutable std::mutex mutex;
+    std::vector<std::string> samples;
+    size_t next = 0;
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Fixed-width big-endian integers, so that bytewise order of encoded values matches numeric order
+namespace KeyCoding {
+    inline void appendFixed32(std::string& dst, uint32_t value) {
+        char buf[4];
+        for (int i = 3; i >= 0; --i) {
+            buf[i] = static_cast<char>(value & 0xff);
+            value >>= 8;
+        }
+        dst.append(buf, sizeof(buf));
+    }
+
+    inline void appendFixed64(std::string& dst, uint64_t value) {
+        char buf[8];
+        for (int i = 7; i >= 0; --i) {
+            buf[i] = static_cast<char>(value & 0xff);
+            value >>= 8;
+        }
+        dst.append(buf, sizeof(buf));
+    }
+
+    inline uint32_t decodeFixed32(const char* ptr) {
+        const auto* p = reinterpret_cast<const unsigned char*>(ptr);
+        return (static_cast<uint32_t>(p[0]) << 24) |
+               (static_cast<uint32_t>(p[1]) << 16) |
+               (static_cast<uint32_t>(p[2]) << 8) |
+               static_cast<uint32_t>(p[3]);
+    }
+
+    inline uint64_t decodeFixed64(const char* ptr) {
+        return (static_cast<uint64_t>(decodeFixed32(ptr)) << 32) | decodeFixed32(ptr + 4);
+    }
+}
@@ -0,0 +1,322 @@
+#include "keyFormat.hpp"
+
+#include <filesystem>
+#include <utility>
+
+#include "leveldb/write_batch.h"
+#include "src/db/comparator.hpp"
+#include "src/db/dbConnector.hpp"
+#include "src/db/fullKey.hpp"
+#include "src/db/keyCoding.hpp"
+#include "src/db/logRecord.hpp"
+
+namespace {
+    // Format history:
+    //  1 - zero-padded decimal ids and seqs, length-first comparator, no marker
+    //  2 - big-endian binary ids and seqs, length-first comparator
+    //  3 - length-prefixed user key in '!' history keys, bytewise comparator
+    //  4 - '#' log records hold the value after the stamped key, see LogRecord
+    // Formats 1 and 2 can not be opened with bytewise comparator, so they are copied into a new database in format 3.
+    // Format 3 is upgraded in place, since its log and history may live in other databases
+    const std::string kFormatVersionKey = "~format";
+    const std::string kFormatVersion = "4";
+    const std::string kBareLogVersion = "3";
+    //Last log record converted by an interrupted upgrade, kept in the log database
+    const std::string kLogUpgradeKey = "~logupgrade";
+    const std::string kSeqBaseKey = "~seqbase";
+    const std::string kSeqProbeKey = "~seqprobe";
+
+    //Metadata keys sort after every namespace, so the first key tells whether a database holds any data
+    const std::string kLayoutKey = "~layout";
+    const std::string kSingleLayout = "single";
+    const std::string kSplitLayout = "split";
+
+    const std::string kUpgradeSuffix = ".upgrade";
+    const std::string kBackupSuffix = ".old";
+
+    constexpr size_t kUpgradeBatchBytes = 1 << 20;
+
+    constexpr size_t kDecimalSeqLength = 15;
+    constexpr size_t kDecimalIdLength = 10;
+
+    bool isDigit(char c) {
+        return c >= '0' && c <= '9';
+    }
+
+    bool isDecimal(const std::string& s, size_t pos, size_t len) {
+        if (s.size() < pos + len)
+            return false;
+        for (size_t i = pos; i < pos + len; ++i) {
+            if (!isDigit(s[i]))
+                return false;
+        }
+        return true;
+    }
+
+    // Binary keys never look like these: in formats 2 and 3 the byte in the checked position is
+    // the high byte of a replica id, which is zero for any realistic cluster size
+    bool isDecimalRecord(const std::string& key) {
+        if (key.empty())
+            return false;
+        switch (key[0]) {
+            case '#':
+                return key.size() == 1 + kDecimalIdLength - 1 + kDecimalSeqLength && isDecimal(key, 1, key.size() - 1);
+            case '@':
+                return isDecimal(key, 1, kDecimalIdLength - 1);
+            case '!':
+                return key.size() >= 1 + kDecimalSeqLength + kDecimalIdLength &&
+                       isDecimal(key, key.size() - kDecimalSeqLength - kDecimalIdLength, kDecimalSeqLength + kDecimalIdLength);
+            default:
+                return isDecimal(key, 0, kDecimalIdLength);
+        }
+    }
+
+    std::string decimalLseqToLseq(const std::string& lseq) {
+        int id = std::stoi(lseq.substr(1, kDecimalIdLength - 1));
+        leveldb::SequenceNumber seq = std::stoull(lseq.substr(kDecimalIdLength));
+        return dbConnector::generateLseqKey(seq, id);
+    }
+
+    std::string decimalNormalKeyToNormalKey(const std::string& key) {
+        int id = std::stoi(key.substr(0, kDecimalIdLength));
+        return dbConnector::generateNormalKey(key.substr(kDecimalIdLength), id);
+    }
+
+    std::pair<std::string, std::string> decimalRecordToRecord(const std::string& key, const std::string& value) {
+        switch (key[0]) {
+            case '#':
+                return {decimalLseqToLseq(key), decimalNormalKeyToNormalKey(value)};
+            case '@':
+                return {std::string("@") + decimalNormalKeyToNormalKey("0" + key.substr(1)), decimalLseqToLseq(value)};
+            case '!': {
+                size_t keyLength = key.size() - 1 - kDecimalSeqLength - kDecimalIdLength;
+                leveldb::SequenceNumber seq = std::stoull(key.substr(1 + keyLength, kDecimalSeqLength));
+                int id = std::stoi(key.substr(1 + keyLength + kDecimalSeqLength));
+                return {FullKey(key.substr(1, keyLength), seq, id).getFullKey(), value};
+            }
+            default:
+                return {decimalNormalKeyToNormalKey(key), value};
+        }
+    }
+
+    //Format 2 history key: '!' + key + seq + replica id
+    std::pair<std::string, std::string> binaryRecordToRecord(const std::string& key, const std::string& value) {
+        if (key.empty() || key[0] != '!' || key.size() < 1 + FullKey::kSeqNumberLength + FullKey::kReplicaIdLength)
+            return {key, value};
+        size_t keyLength = key.size() - 1 - FullKey::kSeqNumberLength - FullKey::kReplicaIdLength;
+        leveldb::SequenceNumber seq = KeyCoding::decodeFixed64(key.data() + 1 + keyLength);
+        int id = static_cast<int>(KeyCoding::decodeFixed32(key.data() + 1 + keyLength + FullKey::kSeqNumberLength));
+        return {FullKey(key.substr(1, keyLength), seq, id).getFullKey(), value};
+    }
+
+    leveldb::Status openRaw(const leveldb::Options& options, const std::string& dbFile, std::unique_ptr<leveldb::DB>& db) {
+        leveldb::DB* raw_db;
+        leveldb::Status status = leveldb::DB::Open(options, dbFile, &raw_db);
+        if (status.ok())
+            db.reset(raw_db);
+        return status;
+    }
+
+    leveldb::Status copyLengthOrdered(const leveldb::Options& options, const std::string& from, const std::string& to) {
+        leveldb::Options sourceOptions = options;
+        sourceOptions.comparator = &(leveldb::GLOBAL_COMPARATOR);
+        sourceOptions.create_if_missing = false;
+        std::unique_ptr<leveldb::DB> source;
+        leveldb::Status status = openRaw(sourceOptions, from, source);
+        if (!status.ok())
+            return status;
+
+        leveldb::Options targetOptions = options;
+        targetOptions.create_if_missing = true;
+        targetOptions.error_if_exists = true;
+        std::unique_ptr<leveldb::DB> target;
+        status = openRaw(targetOptions, to, target);
+        if (!status.ok())
+            return status;
+
+        leveldb::SequenceNumber lastSeq;
+        status = KeyFormat::lastSequence(source.get(), lastSeq);
+        if (!status.ok())
+            return status;
+
+        leveldb::ReadOptions readOptions;
+        readOptions.fill_cache = false;
+        std::unique_ptr<leveldb::Iterator> it(source->NewIterator(readOptions));
+        leveldb::WriteBatch batch;
+        for (it->SeekToFirst(); it->Valid(); it->Next()) {
+            std::string key = it->key().ToString();
+            if (key == kFormatVersionKey)
+                continue;
+            auto [newKey, newValue] = isDecimalRecord(key) ? decimalRecordToRecord(key, it->value().ToString())
+                                                           : binaryRecordToRecord(key, it->value().ToString());
+            batch.Put(newKey, newValue);
+            if (batch.ApproximateSize() >= kUpgradeBatchBytes) {
+                status = target->Write(leveldb::WriteOptions(), &batch);
+                if (!status.ok())
+                    return status;
+                batch.Clear();
+            }
+        }
+        if (!it->status().ok())
+            return it->status();
+
+        std::string seqBase;
+        KeyCoding::appendFixed64(seqBase, lastSeq);
+        batch.Put(kSeqBaseKey, seqBase);
+        batch.Put(kFormatVersionKey, kBareLogVersion);
+        leveldb::WriteOptions writeOptions;
+        writeOptions.sync = true;
+        return target->Write(writeOptions, &batch);
+    }
+
+    //Upgraded copy is built next to the database and swapped in by two renames
+    leveldb::Status upgradeLengthOrdered(const leveldb::Options& options, const std::string& dbFile) {
+        leveldb::Status status = copyLengthOrdered(options, dbFile, dbFile + kUpgradeSuffix);
+        if (!status.ok())
+            return status;
+        std::filesystem::rename(dbFile, dbFile + kBackupSuffix);
+        std::filesystem::rename(dbFile + kUpgradeSuffix, dbFile);
+        return leveldb::DestroyDB(dbFile + kBackupSuffix, options);
+    }
+
+    void recoverInterruptedUpgrade(const leveldb::Options& options, const std::string& dbFile) {
+        if (std::filesystem::exists(dbFile + kBackupSuffix)) {
+            if (std::filesystem::exists(dbFile)) {
+                //Both renames are done, only cleanup is left
+                leveldb::DestroyDB(dbFile + kBackupSuffix, options);
+            } else {
+                //Interrupted between renames, upgrade starts over
+                std::filesystem::rename(dbFile + kBackupSuffix, dbFile);
+            }
+        }
+        if (std::filesystem::exists(dbFile + kUpgradeSuffix)) {
+            leveldb::DestroyDB(dbFile + kUpgradeSuffix, options);
+        }
+    }
+}
+
+leveldb::Status KeyFormat::open(const leveldb::Options& options, const std::string& dbFile,
+                                std::unique_ptr<leveldb::DB>& db, leveldb::SequenceNumber& seqBase) {
+    recoverInterruptedUpgrade(options, dbFile);
+    leveldb::Status status = openRaw(options, dbFile, db);
+    if (status.IsInvalidArgument() && std::filesystem::exists(dbFile)) {
+        //Comparator mismatch: database was written with length-first order
+        status = upgradeLengthOrdered(options, dbFile);
+        if (status.ok())
+            status = openRaw(options, dbFile, db);
+    }
+    if (!status.ok())
+        return status;
+
+    std::string version;
+    status = db->Get(leveldb::ReadOptions(), kFormatVersionKey, &version);
+    if (status.IsNotFound()) {
+        std::unique_ptr<leveldb::Iterator> it(db->NewIterator(leveldb::ReadOptions()));
+        it->SeekToFirst();
+        if (it->Valid()) {
+            return leveldb::Status::Corruption("key format marker is missing");
+        }
+        leveldb::WriteOptions writeOptions;
+        writeOptions.sync = true;
+        status = db->Put(writeOptions, kFormatVersionKey, kFormatVersion);
+        version = kFormatVersion;
+    }
+    if (!status.ok())
+        return status;
+    if (version != kFormatVersion && version != kBareLogVersion)
+        return leveldb::Status::NotSupported("unsupported key format version", version);
+
+    seqBase = 0;
+    std::string encodedBase;
+    status = db->Get(leveldb::ReadOptions(), kSeqBaseKey, &encodedBase);
+    if (status.IsNotFound())
+        return leveldb::Status::OK();
+    if (status.ok() && encodedBase.size() != FullKey::kSeqNumberLength)
+        return leveldb::Status::Corruption("malformed sequence base");
+    if (status.ok())
+        seqBase = KeyCoding::decodeFixed64(encodedBase.data());
+    return status;
+}
+
+leveldb::Status KeyFormat::upgradeLog(leveldb::DB* formatDb, leveldb::DB* lseqDb, leveldb::DB* historyDb) {
+    std::string version;
+    leveldb::Status status = formatDb->Get(leveldb::ReadOptions(), kFormatVersionKey, &version);
+    if (!status.ok() || version == kFormatVersion)
+        return status;
+
+    std::string progress;
+    status = lseqDb->Get(leveldb::ReadOptions(), kLogUpgradeKey, &progress);
+    if (!status.ok() && !status.IsNotFound())
+        return status;
+    leveldb::ReadOptions readOptions;
+    readOptions.fill_cache = false;
+    std::unique_ptr<leveldb::Iterator> it(lseqDb->NewIterator(readOptions));
+    it->Seek(status.ok() ? progress : "#");
+    if (status.ok() && it->Valid() && it->key() == progress)
+        it->Next();
+
+    leveldb::WriteBatch batch;
+    std::string historyKey;
+    std::string value;
+    for (; it->Valid() && dbConnector::isLseqKey(it->key()); it->Next()) {
+        leveldb::Slice lseq = it->key();
+        leveldb::Slice stampedKey = it->value();
+        if (stampedKey.size() < FullKey::kReplicaIdLength)
+            return leveldb::Status::Corruption("malformed log record");
+        leveldb::Slice key(stampedKey.data() + FullKey::kReplicaIdLength, stampedKey.size() - FullKey::kReplicaIdLength);
+        FullKey::encode(historyKey, key, dbConnector::lseqToSeq(lseq), dbConnector::lseqToReplicaId(lseq));
+        //History is written before the log, so every logged version is there
+        status = historyDb->Get(readOptions, historyKey, &value);
+        if (!status.ok())
+            return status;
+        batch.Put(lseq, LogRecord::encode(stampedKey, value));
+        if (batch.ApproximateSize() >= kUpgradeBatchBytes) {
+            //Progress goes with the records it covers: a converted record must never be converted again
+            batch.Put(kLogUpgradeKey, lseq);
+            status = lseqDb->Write(leveldb::WriteOptions(), &batch);
+            if (!status.ok())
+                return status;
+            batch.Clear();
+        }
+    }
+    if (!it->status().ok())
+        return it->status();
+
+    leveldb::WriteOptions writeOptions;
+    writeOptions.sync = true;
+    status = lseqDb->Write(writeOptions, &batch);
+    if (status.ok())
+        status = formatDb->Put(writeOptions, kFormatVersionKey, kFormatVersion);
+    //Dropped only after the marker, a leftover progress key of an upgraded database is never read
+    if (status.ok())
+        status = lseqDb->Delete(leveldb::WriteOptions(), kLogUpgradeKey);
+    return status;
+}
+
+leveldb::Status KeyFormat::lastSequence(leveldb::DB* db, leveldb::SequenceNumber& seq) {
+    //Deleting an absent key yields the last sequence number of the database
+    auto [lastSeq, status] = db->DeleteSequence(leveldb::WriteOptions(), kSeqProbeKey);
+    seq = lastSeq;
+    return status;
+}
+
+leveldb::Status KeyFormat::checkLayout(leveldb::DB* db, bool splitNamespaces) {
+    const std::string& requested = splitNamespaces ? kSplitLayout : kSingleLayout;
+    std::string layout;
+    leveldb::Status status = db->Get(leveldb::ReadOptions(), kLayoutKey, &layout);
+    if (status.IsNotFound()) {
+        //Databases created before the marker keep every namespace together
+        std::unique_ptr<leveldb::Iterator> it(db->NewIterator(leveldb::ReadOptions()));
+        it->SeekToFirst();
+        bool hasData = it->Valid() && it->key()[0] != '~';
+        layout = hasData ? kSingleLayout : requested;
+        leveldb::WriteOptions writeOptions;
+        writeOptions.sync = true;
+        status = db->Put(writeOptions, kLayoutKey, layout);
+    }
+    if (!status.ok())
+        return status;
+    if (layout != requested)
+        return leveldb::Status::InvalidArgument("database was created with another namespace layout", layout);
+    return leveldb::Status::OK();
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "leveldb/db.h"
+
+namespace KeyFormat {
+    //Opens database in the current key format, upgrading databases written by older formats first.
+    //seqBase has to be added to LevelDB sequence numbers of local writes: upgrade moves data
+    //to a new database, whose own sequence numbers start from scratch
+    leveldb::Status open(const leveldb::Options& options, const std::string& dbFile,
+                         std::unique_ptr<leveldb::DB>& db, leveldb::SequenceNumber& seqBase);
+
+    //Records namespace layout of a new database; an existing one has to be reopened with the layout it was created with
+    leveldb::Status checkLayout(leveldb::DB* db, bool splitNamespaces);
+
+    //Adds values to '#' log records of a format 3 database, reading them from history once. Format marker lives in formatDb;
+    //all three may be the same database. An interrupted upgrade resumes where it stopped
+    leveldb::Status upgradeLog(leveldb::DB* formatDb, leveldb::DB* lseqDb, leveldb::DB* historyDb);
+
+    //Upper bound of every sequence number already used by db. Costs one write
+    leveldb::Status lastSequence(leveldb::DB* db, leveldb::SequenceNumber& seq);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+
+#include "leveldb/db.h"
+#include "src/db/keyCoding.hpp"
+
+// Value of a '#' lseq log record: big-endian stamped key length (4 bytes) + stamped key + value.
+// The value is carried in the log itself, so reading events in lseq order is a sequential scan
+namespace LogRecord {
+    constexpr size_t kKeyLengthLength = 4;
+
+    inline std::string encode(const leveldb::Slice& stampedKey, const leveldb::Slice& value) {
+        std::string record;
+        record.reserve(kKeyLengthLength + stampedKey.size() + value.size());
+        KeyCoding::appendFixed32(record, static_cast<uint32_t>(stampedKey.size()));
+        record.append(stampedKey.data(), stampedKey.size());
+        record.append(value.data(), value.size());
+        return record;
+    }
+
+    //Parts point into record. False if record is malformed
+    inline bool decode(const leveldb::Slice& record, leveldb::Slice& stampedKey, leveldb::Slice& value) {
+        if (record.size() < kKeyLengthLength)
+            return false;
+        size_t keyLength = KeyCoding::decodeFixed32(record.data());
+        if (record.size() - kKeyLengthLength < keyLength)
+            return false;
+        stampedKey = leveldb::Slice(record.data() + kKeyLengthLength, keyLength);
+        value = leveldb::Slice(record.data() + kKeyLengthLength + keyLength, record.size() - kKeyLengthLength - keyLength);
+        return true;
+    }
+}
@@ -0,0 +1,80 @@
+#include "seqTimeline.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "src/db/keyCoding.hpp"
+
+bool SeqTimeline::record(int64_t millis, const std::vector<uint64_t>& seqs, int64_t resolution) {
+    if (!samples.empty()) {
+        if (millis - samples.back().millis < resolution) {
+            return false;
+        }
+        millis = std::max(millis, samples.back().millis);
+    }
+    samples.push_back({millis, seqs});
+    return true;
+}
+
+std::vector<uint64_t> SeqTimeline::coveredAt(int64_t millis) const {
+    //Sequence numbers only grow, so the newest sample old enough covers every older one
+    auto after = std::upper_bound(samples.begin(), samples.end(), millis,
+                                  [](int64_t time, const Sample& sample) { return time < sample.millis; });
+    if (after == samples.begin()) {
+        return {};
+    }
+    return std::prev(after)->seqs;
+}
+
+void SeqTimeline::trimBefore(int64_t millis) {
+    while (samples.size() > 1 && samples[1].millis <= millis) {
+        samples.pop_front();
+    }
+}
+
+// Layout: sample count (4 bytes), then per sample its time (8 bytes), replica count (4 bytes)
+// and a seq per replica (8 bytes each), all big-endian
+std::string SeqTimeline::encode() const {
+    std::string res;
+    KeyCoding::appendFixed32(res, static_cast<uint32_t>(samples.size()));
+    for (const auto& sample : samples) {
+        KeyCoding::appendFixed64(res, static_cast<uint64_t>(sample.millis));
+        KeyCoding::appendFixed32(res, static_cast<uint32_t>(sample.seqs.size()));
+        for (uint64_t seq : sample.seqs) {
+            KeyCoding::appendFixed64(res, seq);
+        }
+    }
+    return res;
+}
+
+bool SeqTimeline::decode(const leveldb::Slice& data) {
+    std::deque<Sample> decoded;
+    const char* p = data.data();
+    const char* end = p + data.size();
+    if (end - p < 4) {
+        return false;
+    }
+    uint32_t count = KeyCoding::decodeFixed32(p);
+    p += 4;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (end - p < 12) {
+            return false;
+        }
+        Sample sample{static_cast<int64_t>(KeyCoding::decodeFixed64(p)), {}};
+        uint32_t replicas = KeyCoding::decodeFixed32(p + 8);
+        p += 12;
+        if (static_cast<uint64_t>(end - p) < static_cast<uint64_t>(replicas) * 8) {
+            return false;
+        }
+        for (uint32_t id = 0; id < replicas; ++id, p += 8) {
+            sample.seqs.push_back(KeyCoding::decodeFixed64(p));
+        }
+        decoded.push_back(std::move(sample));
+    }
+    if (p != end) {
+        return false;
+    }
+    samples = std::move(decoded);
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "leveldb/slice.h"
+
+// Sequence numbers every replica had reached at some local times, oldest sample first.
+// History records carry no timestamps, so a version counts as written before a time
+// once a sample taken at or before that time covers its seq
+class SeqTimeline {
+public:
+    //A sample within resolution of the newest one is skipped, which bounds the size of the timeline.
+    //Times going backwards are clamped to the newest sample. False if skipped
+    bool record(int64_t millis, const std::vector<uint64_t>& seqs, int64_t resolution);
+
+    //Per replica seq up to which every version was written at or before millis, empty if no sample is that old
+    std::vector<uint64_t> coveredAt(int64_t millis) const;
+
+    //Drops samples older than the newest one at or before millis, which covers all of them
+    void trimBefore(int64_t millis);
+
+    size_t size() const {
+        return samples.size();
+    }
+
+    std::string encode() const;
+
+    //Replaces the contents, false for malformed data
+    bool decode(const leveldb::Slice& data);
+
+private:
+    struct Sample {
+        int64_t millis;
+        std::vector<uint64_t> seqs;
+    };
+
+    std::deque<Sample> samples;
+};
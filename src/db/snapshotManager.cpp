@@ -0,0 +1,39 @@
+#include "snapshotManager.hpp"
+
+#include <utility>
+
+SnapshotManager::SnapshotSet::SnapshotSet(const std::vector<leveldb::DB*>& dbs) : dbs(dbs) {
+    snapshots.reserve(dbs.size());
+    for (leveldb::DB* db : dbs) {
+        snapshots.push_back(db->GetSnapshot());
+    }
+}
+
+SnapshotManager::SnapshotSet::~SnapshotSet() {
+    for (size_t i = 0; i < dbs.size(); ++i) {
+        dbs[i]->ReleaseSnapshot(snapshots[i]);
+    }
+}
+
+SnapshotManager::SnapshotManager(std::vector<leveldb::DB*> dbs, std::chrono::microseconds epoch)
+    : dbs(std::move(dbs)), epoch(epoch) {}
+
+std::shared_ptr<const SnapshotManager::SnapshotSet> SnapshotManager::acquire() {
+    //Loaded before the snapshot is taken: a write counted after this point may be missing from it
+    uint64_t observed = generation.load(std::memory_order_acquire);
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(mutex);
+    std::shared_ptr<const SnapshotSet> shared = current.lock();
+    if (shared && currentGeneration == observed && now - takenAt < epoch) {
+        return shared;
+    }
+    shared = std::make_shared<const SnapshotSet>(dbs);
+    current = shared;
+    currentGeneration = observed;
+    takenAt = now;
+    return shared;
+}
+
+void SnapshotManager::advance() {
+    generation.fetch_add(1, std::memory_order_release);
+}
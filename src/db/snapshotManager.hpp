@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "leveldb/db.h"
+
+// Reference-counted read snapshots shared by concurrent readers.
+// A snapshot set is handed out again while it is younger than the epoch and no write was committed since it was taken,
+// so sharing never hides an acknowledged write. It is released as soon as its last reader drops it
+class SnapshotManager {
+public:
+    //One snapshot per database, taken in the order the databases were given
+    class SnapshotSet {
+    public:
+        explicit SnapshotSet(const std::vector<leveldb::DB*>& dbs);
+
+        SnapshotSet(const SnapshotSet&) = delete;
+
+        ~SnapshotSet();
+
+        const leveldb::Snapshot* get(size_t i) const {
+            return snapshots[i];
+        }
+
+    private:
+        std::vector<leveldb::DB*> dbs;
+        std::vector<const leveldb::Snapshot*> snapshots;
+    };
+
+    SnapshotManager(std::vector<leveldb::DB*> dbs, std::chrono::microseconds epoch);
+
+    std::shared_ptr<const SnapshotSet> acquire();
+
+    //Has to be called after every write, before it is acknowledged
+    void advance();
+
+private:
+    std::vector<leveldb::DB*> dbs;
+    std::chrono::microseconds epoch;
+    std::atomic<uint64_t> generation{0};
+
+    std::mutex mutex;
+    std::weak_ptr<const SnapshotSet> current;
+    uint64_t currentGeneration = 0;
+    std::chrono::steady_clock::time_point takenAt;
+};
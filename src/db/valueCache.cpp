@@ -0,0 +1,107 @@
+#include "valueCache.hpp"
+
+#include <functional>
+#include <utility>
+
+ValueCache::ValueCache(size_t capacity, size_t shardCount) {
+    if (shardCount == 0 || capacity / shardCount == 0) {
+        return;
+    }
+    this->shardCount = shardCount;
+    shardCapacity = capacity / shardCount;
+    shards = std::make_unique<Shard[]>(shardCount);
+}
+
+bool ValueCache::lookup(const std::string& key, Entry& entry, uint64_t& ticket) {
+    if (!enabled()) {
+        ticket = 0;
+        return false;
+    }
+    Shard& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto found = shard.index.find(key);
+    if (found == shard.index.end()) {
+        ticket = shard.version;
+        misses.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    shard.lru.splice(shard.lru.begin(), shard.lru, found->second);
+    entry = found->second->second;
+    hits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void ValueCache::fill(const std::string& key, Entry entry, uint64_t ticket) {
+    if (!enabled()) {
+        return;
+    }
+    Shard& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    //Another reader may have filled it already, its entry is just as recent
+    if (shard.version != ticket || shard.index.count(key) > 0) {
+        return;
+    }
+    insert(shard, key, std::move(entry));
+}
+
+void ValueCache::update(const std::string& key, Entry entry) {
+    if (!enabled()) {
+        return;
+    }
+    Shard& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    ++shard.version;
+    auto found = shard.index.find(key);
+    if (found != shard.index.end()) {
+        remove(shard, found);
+    }
+    insert(shard, key, std::move(entry));
+}
+
+void ValueCache::erase(const std::string& key) {
+    if (!enabled()) {
+        return;
+    }
+    Shard& shard = shardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    ++shard.version;
+    auto found = shard.index.find(key);
+    if (found != shard.index.end()) {
+        remove(shard, found);
+    }
+}
+
+ValueCache::Stats ValueCache::stats() const {
+    return {hits.load(std::memory_order_relaxed), misses.load(std::memory_order_relaxed)};
+}
+
+ValueCache::Shard& ValueCache::shardFor(const std::string& key) {
+    return shards[std::hash<std::string>{}(key) % shardCount];
+}
+
+void ValueCache::insert(Shard& shard, const std::string& key, Entry entry) {
+    //An entry larger than the shard would only flush it
+    if (chargeOf(key, entry) > shardCapacity) {
+        return;
+    }
+    shard.charge += chargeOf(key, entry);
+    shard.lru.emplace_front(key, std::move(entry));
+    shard.index.emplace(key, shard.lru.begin());
+    evict(shard);
+}
+
+void ValueCache::remove(Shard& shard, std::unordered_map<std::string, LruList::iterator>::iterator found) {
+    shard.charge -= chargeOf(found->first, found->second->second);
+    shard.lru.erase(found->second);
+    shard.index.erase(found);
+}
+
+void ValueCache::evict(Shard& shard) {
+    while (shard.charge > shardCapacity && !shard.lru.empty()) {
+        remove(shard, shard.index.find(shard.lru.back().first));
+    }
+}
+
+size_t ValueCache::chargeOf(const std::string& key, const Entry& entry) {
+    return key.size() + entry.lseq.size() + entry.value.size();
+}
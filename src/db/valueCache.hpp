@@ -0,0 +1,79 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+// Latest value and lseq per normal key (replica id + key), shared by all readers.
+// Split into independently locked LRU shards, so a hit never touches LevelDB and concurrent hits rarely contend.
+// Writers update entries after their write is applied. Readers fill misses from LevelDB with the ticket of their lookup,
+// and a fill is dropped if any write reached the shard in between, so a value read before a write never replaces it
+class ValueCache {
+public:
+    struct Entry {
+        std::string lseq;
+        std::string value;
+    };
+
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+    };
+
+    //Capacity is in bytes of keys and entries, 0 disables the cache
+    ValueCache(size_t capacity, size_t shardCount);
+
+    ValueCache(const ValueCache&) = delete;
+
+    bool enabled() const {
+        return shardCount > 0;
+    }
+
+    //On a miss ticket is set for a following fill
+    bool lookup(const std::string& key, Entry& entry, uint64_t& ticket);
+
+    void fill(const std::string& key, Entry entry, uint64_t ticket);
+
+    void update(const std::string& key, Entry entry);
+
+    void erase(const std::string& key);
+
+    Stats stats() const;
+
+private:
+    using LruList = std::list<std::pair<std::string, Entry>>;
+
+    struct Shard {
+        std::mutex mutex;
+        //Front is the most recently used
+        LruList lru;
+        std::unordered_map<std::string, LruList::iterator> index;
+        size_t charge = 0;
+        //Bumped by every write to the shard
+        uint64_t version = 0;
+    };
+
+    Shard& shardFor(const std::string& key);
+
+    //Caller holds the shard mutex
+    void insert(Shard& shard, const std::string& key, Entry entry);
+
+    void remove(Shard& shard, std::unordered_map<std::string, LruList::iterator>::iterator found);
+
+    void evict(Shard& shard);
+
+    static size_t chargeOf(const std::string& key, const Entry& entry);
+
+    //0 when disabled
+    size_t shardCount = 0;
+    size_t shardCapacity = 0;
+    std::unique_ptr<Shard[]> shards;
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+};
@@ -2,11 +2,9 @@
 
 #include "utils/yamlConfig.hpp"
 #include "src/server/grpc-server.h"
+#include "src/server/replicator.h"
 
 #include <thread>
-#include <chrono>
-
-using namespace std::chrono_literals;
 
 int main(int argc, char** argv) {
     if (argc != 2)
@@ -17,12 +15,11 @@ int main(int argc, char** argv) {
     YAMLConfig config(argv[1]);
     dbConnector database(config);
 
-    std::thread server([config, &database](){ RunServer(config, &database); });
+    PeerConnections connections(config.getReplicas());
+    //Pushes local data to every peer in the background for as long as the process runs
+    Replicator replicator(config, &database, &connections);
 
-    while (true) {
-        std::this_thread::sleep_for(2000ms);
-        SyncLoop(config, &database);
-    }
+    std::thread server([config, &database](){ RunServer(config, &database); });
 
     server.join();
 
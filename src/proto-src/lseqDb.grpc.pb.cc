@@ -26,9 +26,16 @@ static const char* LSeqDatabase_method_names[] = {
   "/lseqdb.LSeqDatabase/Put",
   "/lseqdb.LSeqDatabase/SeekGet",
   "/lseqdb.LSeqDatabase/GetReplicaEvents",
+  "/lseqdb.LSeqDatabase/SeekGetStream",
+  "/lseqdb.LSeqDatabase/GetReplicaEventsStream",
+  "/lseqdb.LSeqDatabase/Watch",
+  "/lseqdb.LSeqDatabase/ScanRange",
+  "/lseqdb.LSeqDatabase/MultiGetValue",
   "/lseqdb.LSeqDatabase/GetConfig",
   "/lseqdb.LSeqDatabase/SyncGet_",
   "/lseqdb.LSeqDatabase/SyncPut_",
+  "/lseqdb.LSeqDatabase/SyncSeqs_",
+  "/lseqdb.LSeqDatabase/SyncStream",
 };
 
 std::unique_ptr< LSeqDatabase::Stub> LSeqDatabase::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -42,9 +49,16 @@ LSeqDatabase::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chann
   , rpcmethod_Put_(LSeqDatabase_method_names[1], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_SeekGet_(LSeqDatabase_method_names[2], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetReplicaEvents_(LSeqDatabase_method_names[3], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_GetConfig_(LSeqDatabase_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SyncGet__(LSeqDatabase_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
-  , rpcmethod_SyncPut__(LSeqDatabase_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SeekGetStream_(LSeqDatabase_method_names[4], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_GetReplicaEventsStream_(LSeqDatabase_method_names[5], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_Watch_(LSeqDatabase_method_names[6], options.suffix_for_stats(),::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
+  , rpcmethod_ScanRange_(LSeqDatabase_method_names[7], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_MultiGetValue_(LSeqDatabase_method_names[8], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetConfig_(LSeqDatabase_method_names[9], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SyncGet__(LSeqDatabase_method_names[10], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SyncPut__(LSeqDatabase_method_names[11], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SyncSeqs__(LSeqDatabase_method_names[12], options.suffix_for_stats(),::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SyncStream_(LSeqDatabase_method_names[13], options.suffix_for_stats(),::grpc::internal::RpcMethod::BIDI_STREAMING, channel)
   {}
 
 ::grpc::Status LSeqDatabase::Stub::GetValue(::grpc::ClientContext* context, const ::lseqdb::ReplicaKey& request, ::lseqdb::Value* response) {
@@ -139,6 +153,100 @@ void LSeqDatabase::Stub::async::GetReplicaEvents(::grpc::ClientContext* context,
   return result;
 }
 
+::grpc::ClientReader< ::lseqdb::DBItems>* LSeqDatabase::Stub::SeekGetStreamRaw(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::lseqdb::DBItems>::Create(channel_.get(), rpcmethod_SeekGetStream_, context, request);
+}
+
+void LSeqDatabase::Stub::async::SeekGetStream(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest* request, ::grpc::ClientReadReactor< ::lseqdb::DBItems>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::lseqdb::DBItems>::Create(stub_->channel_.get(), stub_->rpcmethod_SeekGetStream_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::lseqdb::DBItems>* LSeqDatabase::Stub::AsyncSeekGetStreamRaw(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::lseqdb::DBItems>::Create(channel_.get(), cq, rpcmethod_SeekGetStream_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::lseqdb::DBItems>* LSeqDatabase::Stub::PrepareAsyncSeekGetStreamRaw(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::lseqdb::DBItems>::Create(channel_.get(), cq, rpcmethod_SeekGetStream_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::lseqdb::DBItems>* LSeqDatabase::Stub::GetReplicaEventsStreamRaw(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::lseqdb::DBItems>::Create(channel_.get(), rpcmethod_GetReplicaEventsStream_, context, request);
+}
+
+void LSeqDatabase::Stub::async::GetReplicaEventsStream(::grpc::ClientContext* context, const ::lseqdb::EventsRequest* request, ::grpc::ClientReadReactor< ::lseqdb::DBItems>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::lseqdb::DBItems>::Create(stub_->channel_.get(), stub_->rpcmethod_GetReplicaEventsStream_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::lseqdb::DBItems>* LSeqDatabase::Stub::AsyncGetReplicaEventsStreamRaw(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::lseqdb::DBItems>::Create(channel_.get(), cq, rpcmethod_GetReplicaEventsStream_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::lseqdb::DBItems>* LSeqDatabase::Stub::PrepareAsyncGetReplicaEventsStreamRaw(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::lseqdb::DBItems>::Create(channel_.get(), cq, rpcmethod_GetReplicaEventsStream_, context, request, false, nullptr);
+}
+
+::grpc::ClientReader< ::lseqdb::DBItems>* LSeqDatabase::Stub::WatchRaw(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request) {
+  return ::grpc::internal::ClientReaderFactory< ::lseqdb::DBItems>::Create(channel_.get(), rpcmethod_Watch_, context, request);
+}
+
+void LSeqDatabase::Stub::async::Watch(::grpc::ClientContext* context, const ::lseqdb::WatchRequest* request, ::grpc::ClientReadReactor< ::lseqdb::DBItems>* reactor) {
+  ::grpc::internal::ClientCallbackReaderFactory< ::lseqdb::DBItems>::Create(stub_->channel_.get(), stub_->rpcmethod_Watch_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::lseqdb::DBItems>* LSeqDatabase::Stub::AsyncWatchRaw(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::lseqdb::DBItems>::Create(channel_.get(), cq, rpcmethod_Watch_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::lseqdb::DBItems>* LSeqDatabase::Stub::PrepareAsyncWatchRaw(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderFactory< ::lseqdb::DBItems>::Create(channel_.get(), cq, rpcmethod_Watch_, context, request, false, nullptr);
+}
+
+::grpc::Status LSeqDatabase::Stub::ScanRange(::grpc::ClientContext* context, const ::lseqdb::ScanRequest& request, ::lseqdb::DBItems* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::lseqdb::ScanRequest, ::lseqdb::DBItems, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_ScanRange_, context, request, response);
+}
+
+void LSeqDatabase::Stub::async::ScanRange(::grpc::ClientContext* context, const ::lseqdb::ScanRequest* request, ::lseqdb::DBItems* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::lseqdb::ScanRequest, ::lseqdb::DBItems, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ScanRange_, context, request, response, std::move(f));
+}
+
+void LSeqDatabase::Stub::async::ScanRange(::grpc::ClientContext* context, const ::lseqdb::ScanRequest* request, ::lseqdb::DBItems* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_ScanRange_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>* LSeqDatabase::Stub::PrepareAsyncScanRangeRaw(::grpc::ClientContext* context, const ::lseqdb::ScanRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::lseqdb::DBItems, ::lseqdb::ScanRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_ScanRange_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>* LSeqDatabase::Stub::AsyncScanRangeRaw(::grpc::ClientContext* context, const ::lseqdb::ScanRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncScanRangeRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::Status LSeqDatabase::Stub::MultiGetValue(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest& request, ::lseqdb::DBItems* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::lseqdb::MultiGetRequest, ::lseqdb::DBItems, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_MultiGetValue_, context, request, response);
+}
+
+void LSeqDatabase::Stub::async::MultiGetValue(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest* request, ::lseqdb::DBItems* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::lseqdb::MultiGetRequest, ::lseqdb::DBItems, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MultiGetValue_, context, request, response, std::move(f));
+}
+
+void LSeqDatabase::Stub::async::MultiGetValue(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest* request, ::lseqdb::DBItems* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_MultiGetValue_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>* LSeqDatabase::Stub::PrepareAsyncMultiGetValueRaw(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::lseqdb::DBItems, ::lseqdb::MultiGetRequest, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_MultiGetValue_, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>* LSeqDatabase::Stub::AsyncMultiGetValueRaw(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncMultiGetValueRaw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
 ::grpc::Status LSeqDatabase::Stub::GetConfig(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::lseqdb::Config* response) {
   return ::grpc::internal::BlockingUnaryCall< ::google::protobuf::Empty, ::lseqdb::Config, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_GetConfig_, context, request, response);
 }
@@ -208,6 +316,45 @@ void LSeqDatabase::Stub::async::SyncPut_(::grpc::ClientContext* context, const :
   return result;
 }
 
+::grpc::Status LSeqDatabase::Stub::SyncSeqs_(::grpc::ClientContext* context, const ::lseqdb::SeqVector& request, ::lseqdb::SeqVector* response) {
+  return ::grpc::internal::BlockingUnaryCall< ::lseqdb::SeqVector, ::lseqdb::SeqVector, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), rpcmethod_SyncSeqs__, context, request, response);
+}
+
+void LSeqDatabase::Stub::async::SyncSeqs_(::grpc::ClientContext* context, const ::lseqdb::SeqVector* request, ::lseqdb::SeqVector* response, std::function<void(::grpc::Status)> f) {
+  ::grpc::internal::CallbackUnaryCall< ::lseqdb::SeqVector, ::lseqdb::SeqVector, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SyncSeqs__, context, request, response, std::move(f));
+}
+
+void LSeqDatabase::Stub::async::SyncSeqs_(::grpc::ClientContext* context, const ::lseqdb::SeqVector* request, ::lseqdb::SeqVector* response, ::grpc::ClientUnaryReactor* reactor) {
+  ::grpc::internal::ClientCallbackUnaryFactory::Create< ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(stub_->channel_.get(), stub_->rpcmethod_SyncSeqs__, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::lseqdb::SeqVector>* LSeqDatabase::Stub::PrepareAsyncSyncSeqs_Raw(::grpc::ClientContext* context, const ::lseqdb::SeqVector& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncResponseReaderHelper::Create< ::lseqdb::SeqVector, ::lseqdb::SeqVector, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(channel_.get(), cq, rpcmethod_SyncSeqs__, context, request);
+}
+
+::grpc::ClientAsyncResponseReader< ::lseqdb::SeqVector>* LSeqDatabase::Stub::AsyncSyncSeqs_Raw(::grpc::ClientContext* context, const ::lseqdb::SeqVector& request, ::grpc::CompletionQueue* cq) {
+  auto* result =
+    this->PrepareAsyncSyncSeqs_Raw(context, request, cq);
+  result->StartCall();
+  return result;
+}
+
+::grpc::ClientReaderWriter< ::lseqdb::DBItems, ::lseqdb::SyncAck>* LSeqDatabase::Stub::SyncStreamRaw(::grpc::ClientContext* context) {
+  return ::grpc::internal::ClientReaderWriterFactory< ::lseqdb::DBItems, ::lseqdb::SyncAck>::Create(channel_.get(), rpcmethod_SyncStream_, context);
+}
+
+void LSeqDatabase::Stub::async::SyncStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::lseqdb::DBItems,::lseqdb::SyncAck>* reactor) {
+  ::grpc::internal::ClientCallbackReaderWriterFactory< ::lseqdb::DBItems,::lseqdb::SyncAck>::Create(stub_->channel_.get(), stub_->rpcmethod_SyncStream_, context, reactor);
+}
+
+::grpc::ClientAsyncReaderWriter< ::lseqdb::DBItems, ::lseqdb::SyncAck>* LSeqDatabase::Stub::AsyncSyncStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::lseqdb::DBItems, ::lseqdb::SyncAck>::Create(channel_.get(), cq, rpcmethod_SyncStream_, context, true, tag);
+}
+
+::grpc::ClientAsyncReaderWriter< ::lseqdb::DBItems, ::lseqdb::SyncAck>* LSeqDatabase::Stub::PrepareAsyncSyncStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+  return ::grpc::internal::ClientAsyncReaderWriterFactory< ::lseqdb::DBItems, ::lseqdb::SyncAck>::Create(channel_.get(), cq, rpcmethod_SyncStream_, context, false, nullptr);
+}
+
 LSeqDatabase::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       LSeqDatabase_method_names[0],
@@ -251,6 +398,56 @@ LSeqDatabase::Service::Service() {
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       LSeqDatabase_method_names[4],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< LSeqDatabase::Service, ::lseqdb::SeekGetRequest, ::lseqdb::DBItems>(
+          [](LSeqDatabase::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::lseqdb::SeekGetRequest* req,
+             ::grpc::ServerWriter<::lseqdb::DBItems>* writer) {
+               return service->SeekGetStream(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      LSeqDatabase_method_names[5],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< LSeqDatabase::Service, ::lseqdb::EventsRequest, ::lseqdb::DBItems>(
+          [](LSeqDatabase::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::lseqdb::EventsRequest* req,
+             ::grpc::ServerWriter<::lseqdb::DBItems>* writer) {
+               return service->GetReplicaEventsStream(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      LSeqDatabase_method_names[6],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< LSeqDatabase::Service, ::lseqdb::WatchRequest, ::lseqdb::DBItems>(
+          [](LSeqDatabase::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::lseqdb::WatchRequest* req,
+             ::grpc::ServerWriter<::lseqdb::DBItems>* writer) {
+               return service->Watch(ctx, req, writer);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      LSeqDatabase_method_names[7],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< LSeqDatabase::Service, ::lseqdb::ScanRequest, ::lseqdb::DBItems, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](LSeqDatabase::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::lseqdb::ScanRequest* req,
+             ::lseqdb::DBItems* resp) {
+               return service->ScanRange(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      LSeqDatabase_method_names[8],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< LSeqDatabase::Service, ::lseqdb::MultiGetRequest, ::lseqdb::DBItems, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](LSeqDatabase::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::lseqdb::MultiGetRequest* req,
+             ::lseqdb::DBItems* resp) {
+               return service->MultiGetValue(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      LSeqDatabase_method_names[9],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< LSeqDatabase::Service, ::google::protobuf::Empty, ::lseqdb::Config, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](LSeqDatabase::Service* service,
@@ -260,7 +457,7 @@ LSeqDatabase::Service::Service() {
                return service->GetConfig(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      LSeqDatabase_method_names[5],
+      LSeqDatabase_method_names[10],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< LSeqDatabase::Service, ::lseqdb::SyncGetRequest, ::lseqdb::LSeq, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](LSeqDatabase::Service* service,
@@ -270,7 +467,7 @@ LSeqDatabase::Service::Service() {
                return service->SyncGet_(ctx, req, resp);
              }, this)));
   AddMethod(new ::grpc::internal::RpcServiceMethod(
-      LSeqDatabase_method_names[6],
+      LSeqDatabase_method_names[11],
       ::grpc::internal::RpcMethod::NORMAL_RPC,
       new ::grpc::internal::RpcMethodHandler< LSeqDatabase::Service, ::lseqdb::DBItems, ::google::protobuf::Empty, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
           [](LSeqDatabase::Service* service,
@@ -279,6 +476,26 @@ LSeqDatabase::Service::Service() {
              ::google::protobuf::Empty* resp) {
                return service->SyncPut_(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      LSeqDatabase_method_names[12],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< LSeqDatabase::Service, ::lseqdb::SeqVector, ::lseqdb::SeqVector, ::grpc::protobuf::MessageLite, ::grpc::protobuf::MessageLite>(
+          [](LSeqDatabase::Service* service,
+             ::grpc::ServerContext* ctx,
+             const ::lseqdb::SeqVector* req,
+             ::lseqdb::SeqVector* resp) {
+               return service->SyncSeqs_(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      LSeqDatabase_method_names[13],
+      ::grpc::internal::RpcMethod::BIDI_STREAMING,
+      new ::grpc::internal::BidiStreamingHandler< LSeqDatabase::Service, ::lseqdb::DBItems, ::lseqdb::SyncAck>(
+          [](LSeqDatabase::Service* service,
+             ::grpc::ServerContext* ctx,
+             ::grpc::ServerReaderWriter<::lseqdb::SyncAck,
+             ::lseqdb::DBItems>* stream) {
+               return service->SyncStream(ctx, stream);
+             }, this)));
 }
 
 LSeqDatabase::Service::~Service() {
@@ -312,6 +529,41 @@ LSeqDatabase::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status LSeqDatabase::Service::SeekGetStream(::grpc::ServerContext* context, const ::lseqdb::SeekGetRequest* request, ::grpc::ServerWriter< ::lseqdb::DBItems>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status LSeqDatabase::Service::GetReplicaEventsStream(::grpc::ServerContext* context, const ::lseqdb::EventsRequest* request, ::grpc::ServerWriter< ::lseqdb::DBItems>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status LSeqDatabase::Service::Watch(::grpc::ServerContext* context, const ::lseqdb::WatchRequest* request, ::grpc::ServerWriter< ::lseqdb::DBItems>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status LSeqDatabase::Service::ScanRange(::grpc::ServerContext* context, const ::lseqdb::ScanRequest* request, ::lseqdb::DBItems* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status LSeqDatabase::Service::MultiGetValue(::grpc::ServerContext* context, const ::lseqdb::MultiGetRequest* request, ::lseqdb::DBItems* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 ::grpc::Status LSeqDatabase::Service::GetConfig(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::lseqdb::Config* response) {
   (void) context;
   (void) request;
@@ -333,6 +585,19 @@ LSeqDatabase::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status LSeqDatabase::Service::SyncSeqs_(::grpc::ServerContext* context, const ::lseqdb::SeqVector* request, ::lseqdb::SeqVector* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status LSeqDatabase::Service::SyncStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::lseqdb::SyncAck, ::lseqdb::DBItems>* stream) {
+  (void) context;
+  (void) stream;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace lseqdb
 
@@ -65,6 +65,52 @@ class LSeqDatabase final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>> PrepareAsyncGetReplicaEvents(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>>(PrepareAsyncGetReplicaEventsRaw(context, request, cq));
     }
+    //  Same items sent in chunks as they are read. An interrupted stream is continued
+    //  by repeating the request with lseq of the last received item
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::lseqdb::DBItems>> SeekGetStream(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::lseqdb::DBItems>>(SeekGetStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>> AsyncSeekGetStream(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>>(AsyncSeekGetStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>> PrepareAsyncSeekGetStream(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>>(PrepareAsyncSeekGetStreamRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::lseqdb::DBItems>> GetReplicaEventsStream(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::lseqdb::DBItems>>(GetReplicaEventsStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>> AsyncGetReplicaEventsStream(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>>(AsyncGetReplicaEventsStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>> PrepareAsyncGetReplicaEventsStream(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>>(PrepareAsyncGetReplicaEventsStreamRaw(context, request, cq));
+    }
+    //  Events of one replica after from_lseq, then new ones as they are committed. Never ends by itself
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::lseqdb::DBItems>> Watch(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::lseqdb::DBItems>>(WatchRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>> AsyncWatch(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>>(AsyncWatchRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>> PrepareAsyncWatch(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>>(PrepareAsyncWatchRaw(context, request, cq));
+    }
+    //  Latest values of one replica in key order
+    virtual ::grpc::Status ScanRange(::grpc::ClientContext* context, const ::lseqdb::ScanRequest& request, ::lseqdb::DBItems* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>> AsyncScanRange(::grpc::ClientContext* context, const ::lseqdb::ScanRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>>(AsyncScanRangeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>> PrepareAsyncScanRange(::grpc::ClientContext* context, const ::lseqdb::ScanRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>>(PrepareAsyncScanRangeRaw(context, request, cq));
+    }
+    //  Latest values of several keys of one replica in key order, missing keys are left out
+    virtual ::grpc::Status MultiGetValue(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest& request, ::lseqdb::DBItems* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>> AsyncMultiGetValue(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>>(AsyncMultiGetValueRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>> PrepareAsyncMultiGetValue(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>>(PrepareAsyncMultiGetValueRaw(context, request, cq));
+    }
     //  Info about cluster and replicas
     virtual ::grpc::Status GetConfig(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::lseqdb::Config* response) = 0;
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::Config>> AsyncGetConfig(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
@@ -88,6 +134,26 @@ class LSeqDatabase final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>> PrepareAsyncSyncPut_(::grpc::ClientContext* context, const ::lseqdb::DBItems& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>>(PrepareAsyncSyncPut_Raw(context, request, cq));
     }
+    //  Takes the seqs of the caller and returns the seqs of this replica for the same replica ids,
+    //  so the caller finds every range this replica is missing with one round trip
+    virtual ::grpc::Status SyncSeqs_(::grpc::ClientContext* context, const ::lseqdb::SeqVector& request, ::lseqdb::SeqVector* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::SeqVector>> AsyncSyncSeqs_(::grpc::ClientContext* context, const ::lseqdb::SeqVector& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::SeqVector>>(AsyncSyncSeqs_Raw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::SeqVector>> PrepareAsyncSyncSeqs_(::grpc::ClientContext* context, const ::lseqdb::SeqVector& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::SeqVector>>(PrepareAsyncSyncSeqs_Raw(context, request, cq));
+    }
+    //  Log chunks of one replica, each acknowledged once it is applied.
+    //  An interrupted stream is resumed after the last acknowledged lseq
+    std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::lseqdb::DBItems, ::lseqdb::SyncAck>> SyncStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriterInterface< ::lseqdb::DBItems, ::lseqdb::SyncAck>>(SyncStreamRaw(context));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::lseqdb::DBItems, ::lseqdb::SyncAck>> AsyncSyncStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::lseqdb::DBItems, ::lseqdb::SyncAck>>(AsyncSyncStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::lseqdb::DBItems, ::lseqdb::SyncAck>> PrepareAsyncSyncStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriterInterface< ::lseqdb::DBItems, ::lseqdb::SyncAck>>(PrepareAsyncSyncStreamRaw(context, cq));
+    }
     class async_interface {
      public:
       virtual ~async_interface() {}
@@ -101,6 +167,18 @@ class LSeqDatabase final {
       virtual void SeekGet(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest* request, ::lseqdb::DBItems* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void GetReplicaEvents(::grpc::ClientContext* context, const ::lseqdb::EventsRequest* request, ::lseqdb::DBItems* response, std::function<void(::grpc::Status)>) = 0;
       virtual void GetReplicaEvents(::grpc::ClientContext* context, const ::lseqdb::EventsRequest* request, ::lseqdb::DBItems* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      //  Same items sent in chunks as they are read. An interrupted stream is continued
+      //  by repeating the request with lseq of the last received item
+      virtual void SeekGetStream(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest* request, ::grpc::ClientReadReactor< ::lseqdb::DBItems>* reactor) = 0;
+      virtual void GetReplicaEventsStream(::grpc::ClientContext* context, const ::lseqdb::EventsRequest* request, ::grpc::ClientReadReactor< ::lseqdb::DBItems>* reactor) = 0;
+      //  Events of one replica after from_lseq, then new ones as they are committed. Never ends by itself
+      virtual void Watch(::grpc::ClientContext* context, const ::lseqdb::WatchRequest* request, ::grpc::ClientReadReactor< ::lseqdb::DBItems>* reactor) = 0;
+      //  Latest values of one replica in key order
+      virtual void ScanRange(::grpc::ClientContext* context, const ::lseqdb::ScanRequest* request, ::lseqdb::DBItems* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void ScanRange(::grpc::ClientContext* context, const ::lseqdb::ScanRequest* request, ::lseqdb::DBItems* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      //  Latest values of several keys of one replica in key order, missing keys are left out
+      virtual void MultiGetValue(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest* request, ::lseqdb::DBItems* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void MultiGetValue(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest* request, ::lseqdb::DBItems* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       //  Info about cluster and replicas
       virtual void GetConfig(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::lseqdb::Config* response, std::function<void(::grpc::Status)>) = 0;
       virtual void GetConfig(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::lseqdb::Config* response, ::grpc::ClientUnaryReactor* reactor) = 0;
@@ -109,6 +187,13 @@ class LSeqDatabase final {
       virtual void SyncGet_(::grpc::ClientContext* context, const ::lseqdb::SyncGetRequest* request, ::lseqdb::LSeq* response, ::grpc::ClientUnaryReactor* reactor) = 0;
       virtual void SyncPut_(::grpc::ClientContext* context, const ::lseqdb::DBItems* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) = 0;
       virtual void SyncPut_(::grpc::ClientContext* context, const ::lseqdb::DBItems* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      //  Takes the seqs of the caller and returns the seqs of this replica for the same replica ids,
+      //  so the caller finds every range this replica is missing with one round trip
+      virtual void SyncSeqs_(::grpc::ClientContext* context, const ::lseqdb::SeqVector* request, ::lseqdb::SeqVector* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SyncSeqs_(::grpc::ClientContext* context, const ::lseqdb::SeqVector* request, ::lseqdb::SeqVector* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      //  Log chunks of one replica, each acknowledged once it is applied.
+      //  An interrupted stream is resumed after the last acknowledged lseq
+      virtual void SyncStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::lseqdb::DBItems,::lseqdb::SyncAck>* reactor) = 0;
     };
     typedef class async_interface experimental_async_interface;
     virtual class async_interface* async() { return nullptr; }
@@ -122,12 +207,30 @@ class LSeqDatabase final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>* PrepareAsyncSeekGetRaw(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>* AsyncGetReplicaEventsRaw(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>* PrepareAsyncGetReplicaEventsRaw(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::lseqdb::DBItems>* SeekGetStreamRaw(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>* AsyncSeekGetStreamRaw(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>* PrepareAsyncSeekGetStreamRaw(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::lseqdb::DBItems>* GetReplicaEventsStreamRaw(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>* AsyncGetReplicaEventsStreamRaw(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>* PrepareAsyncGetReplicaEventsStreamRaw(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::lseqdb::DBItems>* WatchRaw(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>* AsyncWatchRaw(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::lseqdb::DBItems>* PrepareAsyncWatchRaw(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>* AsyncScanRangeRaw(::grpc::ClientContext* context, const ::lseqdb::ScanRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>* PrepareAsyncScanRangeRaw(::grpc::ClientContext* context, const ::lseqdb::ScanRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>* AsyncMultiGetValueRaw(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::DBItems>* PrepareAsyncMultiGetValueRaw(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::Config>* AsyncGetConfigRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::Config>* PrepareAsyncGetConfigRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::LSeq>* AsyncSyncGet_Raw(::grpc::ClientContext* context, const ::lseqdb::SyncGetRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::LSeq>* PrepareAsyncSyncGet_Raw(::grpc::ClientContext* context, const ::lseqdb::SyncGetRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* AsyncSyncPut_Raw(::grpc::ClientContext* context, const ::lseqdb::DBItems& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::google::protobuf::Empty>* PrepareAsyncSyncPut_Raw(::grpc::ClientContext* context, const ::lseqdb::DBItems& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::SeqVector>* AsyncSyncSeqs_Raw(::grpc::ClientContext* context, const ::lseqdb::SeqVector& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::lseqdb::SeqVector>* PrepareAsyncSyncSeqs_Raw(::grpc::ClientContext* context, const ::lseqdb::SeqVector& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderWriterInterface< ::lseqdb::DBItems, ::lseqdb::SyncAck>* SyncStreamRaw(::grpc::ClientContext* context) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::lseqdb::DBItems, ::lseqdb::SyncAck>* AsyncSyncStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderWriterInterface< ::lseqdb::DBItems, ::lseqdb::SyncAck>* PrepareAsyncSyncStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -160,6 +263,47 @@ class LSeqDatabase final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>> PrepareAsyncGetReplicaEvents(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>>(PrepareAsyncGetReplicaEventsRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReader< ::lseqdb::DBItems>> SeekGetStream(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::lseqdb::DBItems>>(SeekGetStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::lseqdb::DBItems>> AsyncSeekGetStream(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::lseqdb::DBItems>>(AsyncSeekGetStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::lseqdb::DBItems>> PrepareAsyncSeekGetStream(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::lseqdb::DBItems>>(PrepareAsyncSeekGetStreamRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::lseqdb::DBItems>> GetReplicaEventsStream(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::lseqdb::DBItems>>(GetReplicaEventsStreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::lseqdb::DBItems>> AsyncGetReplicaEventsStream(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::lseqdb::DBItems>>(AsyncGetReplicaEventsStreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::lseqdb::DBItems>> PrepareAsyncGetReplicaEventsStream(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::lseqdb::DBItems>>(PrepareAsyncGetReplicaEventsStreamRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReader< ::lseqdb::DBItems>> Watch(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::lseqdb::DBItems>>(WatchRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::lseqdb::DBItems>> AsyncWatch(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::lseqdb::DBItems>>(AsyncWatchRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::lseqdb::DBItems>> PrepareAsyncWatch(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::lseqdb::DBItems>>(PrepareAsyncWatchRaw(context, request, cq));
+    }
+    ::grpc::Status ScanRange(::grpc::ClientContext* context, const ::lseqdb::ScanRequest& request, ::lseqdb::DBItems* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>> AsyncScanRange(::grpc::ClientContext* context, const ::lseqdb::ScanRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>>(AsyncScanRangeRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>> PrepareAsyncScanRange(::grpc::ClientContext* context, const ::lseqdb::ScanRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>>(PrepareAsyncScanRangeRaw(context, request, cq));
+    }
+    ::grpc::Status MultiGetValue(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest& request, ::lseqdb::DBItems* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>> AsyncMultiGetValue(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>>(AsyncMultiGetValueRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>> PrepareAsyncMultiGetValue(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>>(PrepareAsyncMultiGetValueRaw(context, request, cq));
+    }
     ::grpc::Status GetConfig(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::lseqdb::Config* response) override;
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::Config>> AsyncGetConfig(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::Config>>(AsyncGetConfigRaw(context, request, cq));
@@ -181,6 +325,22 @@ class LSeqDatabase final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>> PrepareAsyncSyncPut_(::grpc::ClientContext* context, const ::lseqdb::DBItems& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>>(PrepareAsyncSyncPut_Raw(context, request, cq));
     }
+    ::grpc::Status SyncSeqs_(::grpc::ClientContext* context, const ::lseqdb::SeqVector& request, ::lseqdb::SeqVector* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::SeqVector>> AsyncSyncSeqs_(::grpc::ClientContext* context, const ::lseqdb::SeqVector& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::SeqVector>>(AsyncSyncSeqs_Raw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::SeqVector>> PrepareAsyncSyncSeqs_(::grpc::ClientContext* context, const ::lseqdb::SeqVector& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::lseqdb::SeqVector>>(PrepareAsyncSyncSeqs_Raw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientReaderWriter< ::lseqdb::DBItems, ::lseqdb::SyncAck>> SyncStream(::grpc::ClientContext* context) {
+      return std::unique_ptr< ::grpc::ClientReaderWriter< ::lseqdb::DBItems, ::lseqdb::SyncAck>>(SyncStreamRaw(context));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::lseqdb::DBItems, ::lseqdb::SyncAck>> AsyncSyncStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::lseqdb::DBItems, ::lseqdb::SyncAck>>(AsyncSyncStreamRaw(context, cq, tag));
+    }
+    std::unique_ptr<  ::grpc::ClientAsyncReaderWriter< ::lseqdb::DBItems, ::lseqdb::SyncAck>> PrepareAsyncSyncStream(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderWriter< ::lseqdb::DBItems, ::lseqdb::SyncAck>>(PrepareAsyncSyncStreamRaw(context, cq));
+    }
     class async final :
       public StubInterface::async_interface {
      public:
@@ -192,12 +352,22 @@ class LSeqDatabase final {
       void SeekGet(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest* request, ::lseqdb::DBItems* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetReplicaEvents(::grpc::ClientContext* context, const ::lseqdb::EventsRequest* request, ::lseqdb::DBItems* response, std::function<void(::grpc::Status)>) override;
       void GetReplicaEvents(::grpc::ClientContext* context, const ::lseqdb::EventsRequest* request, ::lseqdb::DBItems* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void SeekGetStream(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest* request, ::grpc::ClientReadReactor< ::lseqdb::DBItems>* reactor) override;
+      void GetReplicaEventsStream(::grpc::ClientContext* context, const ::lseqdb::EventsRequest* request, ::grpc::ClientReadReactor< ::lseqdb::DBItems>* reactor) override;
+      void Watch(::grpc::ClientContext* context, const ::lseqdb::WatchRequest* request, ::grpc::ClientReadReactor< ::lseqdb::DBItems>* reactor) override;
+      void ScanRange(::grpc::ClientContext* context, const ::lseqdb::ScanRequest* request, ::lseqdb::DBItems* response, std::function<void(::grpc::Status)>) override;
+      void ScanRange(::grpc::ClientContext* context, const ::lseqdb::ScanRequest* request, ::lseqdb::DBItems* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void MultiGetValue(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest* request, ::lseqdb::DBItems* response, std::function<void(::grpc::Status)>) override;
+      void MultiGetValue(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest* request, ::lseqdb::DBItems* response, ::grpc::ClientUnaryReactor* reactor) override;
       void GetConfig(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::lseqdb::Config* response, std::function<void(::grpc::Status)>) override;
       void GetConfig(::grpc::ClientContext* context, const ::google::protobuf::Empty* request, ::lseqdb::Config* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SyncGet_(::grpc::ClientContext* context, const ::lseqdb::SyncGetRequest* request, ::lseqdb::LSeq* response, std::function<void(::grpc::Status)>) override;
       void SyncGet_(::grpc::ClientContext* context, const ::lseqdb::SyncGetRequest* request, ::lseqdb::LSeq* response, ::grpc::ClientUnaryReactor* reactor) override;
       void SyncPut_(::grpc::ClientContext* context, const ::lseqdb::DBItems* request, ::google::protobuf::Empty* response, std::function<void(::grpc::Status)>) override;
       void SyncPut_(::grpc::ClientContext* context, const ::lseqdb::DBItems* request, ::google::protobuf::Empty* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void SyncSeqs_(::grpc::ClientContext* context, const ::lseqdb::SeqVector* request, ::lseqdb::SeqVector* response, std::function<void(::grpc::Status)>) override;
+      void SyncSeqs_(::grpc::ClientContext* context, const ::lseqdb::SeqVector* request, ::lseqdb::SeqVector* response, ::grpc::ClientUnaryReactor* reactor) override;
+      void SyncStream(::grpc::ClientContext* context, ::grpc::ClientBidiReactor< ::lseqdb::DBItems,::lseqdb::SyncAck>* reactor) override;
      private:
       friend class Stub;
       explicit async(Stub* stub): stub_(stub) { }
@@ -217,19 +387,44 @@ class LSeqDatabase final {
     ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>* PrepareAsyncSeekGetRaw(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>* AsyncGetReplicaEventsRaw(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>* PrepareAsyncGetReplicaEventsRaw(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::lseqdb::DBItems>* SeekGetStreamRaw(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request) override;
+    ::grpc::ClientAsyncReader< ::lseqdb::DBItems>* AsyncSeekGetStreamRaw(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::lseqdb::DBItems>* PrepareAsyncSeekGetStreamRaw(::grpc::ClientContext* context, const ::lseqdb::SeekGetRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::lseqdb::DBItems>* GetReplicaEventsStreamRaw(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request) override;
+    ::grpc::ClientAsyncReader< ::lseqdb::DBItems>* AsyncGetReplicaEventsStreamRaw(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::lseqdb::DBItems>* PrepareAsyncGetReplicaEventsStreamRaw(::grpc::ClientContext* context, const ::lseqdb::EventsRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::lseqdb::DBItems>* WatchRaw(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request) override;
+    ::grpc::ClientAsyncReader< ::lseqdb::DBItems>* AsyncWatchRaw(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::lseqdb::DBItems>* PrepareAsyncWatchRaw(::grpc::ClientContext* context, const ::lseqdb::WatchRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>* AsyncScanRangeRaw(::grpc::ClientContext* context, const ::lseqdb::ScanRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>* PrepareAsyncScanRangeRaw(::grpc::ClientContext* context, const ::lseqdb::ScanRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>* AsyncMultiGetValueRaw(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::lseqdb::DBItems>* PrepareAsyncMultiGetValueRaw(::grpc::ClientContext* context, const ::lseqdb::MultiGetRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::lseqdb::Config>* AsyncGetConfigRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::lseqdb::Config>* PrepareAsyncGetConfigRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::lseqdb::LSeq>* AsyncSyncGet_Raw(::grpc::ClientContext* context, const ::lseqdb::SyncGetRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::lseqdb::LSeq>* PrepareAsyncSyncGet_Raw(::grpc::ClientContext* context, const ::lseqdb::SyncGetRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* AsyncSyncPut_Raw(::grpc::ClientContext* context, const ::lseqdb::DBItems& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::google::protobuf::Empty>* PrepareAsyncSyncPut_Raw(::grpc::ClientContext* context, const ::lseqdb::DBItems& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::lseqdb::SeqVector>* AsyncSyncSeqs_Raw(::grpc::ClientContext* context, const ::lseqdb::SeqVector& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::lseqdb::SeqVector>* PrepareAsyncSyncSeqs_Raw(::grpc::ClientContext* context, const ::lseqdb::SeqVector& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReaderWriter< ::lseqdb::DBItems, ::lseqdb::SyncAck>* SyncStreamRaw(::grpc::ClientContext* context) override;
+    ::grpc::ClientAsyncReaderWriter< ::lseqdb::DBItems, ::lseqdb::SyncAck>* AsyncSyncStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReaderWriter< ::lseqdb::DBItems, ::lseqdb::SyncAck>* PrepareAsyncSyncStreamRaw(::grpc::ClientContext* context, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_GetValue_;
     const ::grpc::internal::RpcMethod rpcmethod_Put_;
     const ::grpc::internal::RpcMethod rpcmethod_SeekGet_;
     const ::grpc::internal::RpcMethod rpcmethod_GetReplicaEvents_;
+    const ::grpc::internal::RpcMethod rpcmethod_SeekGetStream_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetReplicaEventsStream_;
+    const ::grpc::internal::RpcMethod rpcmethod_Watch_;
+    const ::grpc::internal::RpcMethod rpcmethod_ScanRange_;
+    const ::grpc::internal::RpcMethod rpcmethod_MultiGetValue_;
     const ::grpc::internal::RpcMethod rpcmethod_GetConfig_;
     const ::grpc::internal::RpcMethod rpcmethod_SyncGet__;
     const ::grpc::internal::RpcMethod rpcmethod_SyncPut__;
+    const ::grpc::internal::RpcMethod rpcmethod_SyncSeqs__;
+    const ::grpc::internal::RpcMethod rpcmethod_SyncStream_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -243,11 +438,27 @@ class LSeqDatabase final {
     //  Supports search only within one replica
     virtual ::grpc::Status SeekGet(::grpc::ServerContext* context, const ::lseqdb::SeekGetRequest* request, ::lseqdb::DBItems* response);
     virtual ::grpc::Status GetReplicaEvents(::grpc::ServerContext* context, const ::lseqdb::EventsRequest* request, ::lseqdb::DBItems* response);
+    //  Same items sent in chunks as they are read. An interrupted stream is continued
+    //  by repeating the request with lseq of the last received item
+    virtual ::grpc::Status SeekGetStream(::grpc::ServerContext* context, const ::lseqdb::SeekGetRequest* request, ::grpc::ServerWriter< ::lseqdb::DBItems>* writer);
+    virtual ::grpc::Status GetReplicaEventsStream(::grpc::ServerContext* context, const ::lseqdb::EventsRequest* request, ::grpc::ServerWriter< ::lseqdb::DBItems>* writer);
+    //  Events of one replica after from_lseq, then new ones as they are committed. Never ends by itself
+    virtual ::grpc::Status Watch(::grpc::ServerContext* context, const ::lseqdb::WatchRequest* request, ::grpc::ServerWriter< ::lseqdb::DBItems>* writer);
+    //  Latest values of one replica in key order
+    virtual ::grpc::Status ScanRange(::grpc::ServerContext* context, const ::lseqdb::ScanRequest* request, ::lseqdb::DBItems* response);
+    //  Latest values of several keys of one replica in key order, missing keys are left out
+    virtual ::grpc::Status MultiGetValue(::grpc::ServerContext* context, const ::lseqdb::MultiGetRequest* request, ::lseqdb::DBItems* response);
     //  Info about cluster and replicas
     virtual ::grpc::Status GetConfig(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::lseqdb::Config* response);
     //  System calls for synchronization
     virtual ::grpc::Status SyncGet_(::grpc::ServerContext* context, const ::lseqdb::SyncGetRequest* request, ::lseqdb::LSeq* response);
     virtual ::grpc::Status SyncPut_(::grpc::ServerContext* context, const ::lseqdb::DBItems* request, ::google::protobuf::Empty* response);
+    //  Takes the seqs of the caller and returns the seqs of this replica for the same replica ids,
+    //  so the caller finds every range this replica is missing with one round trip
+    virtual ::grpc::Status SyncSeqs_(::grpc::ServerContext* context, const ::lseqdb::SeqVector* request, ::lseqdb::SeqVector* response);
+    //  Log chunks of one replica, each acknowledged once it is applied.
+    //  An interrupted stream is resumed after the last acknowledged lseq
+    virtual ::grpc::Status SyncStream(::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::lseqdb::SyncAck, ::lseqdb::DBItems>* stream);
   };
   template <class BaseClass>
   class WithAsyncMethod_GetValue : public BaseClass {
@@ -330,12 +541,112 @@ class LSeqDatabase final {
     }
   };
   template <class BaseClass>
+  class WithAsyncMethod_SeekGetStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SeekGetStream() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_SeekGetStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SeekGetStream(::grpc::ServerContext* /*context*/, const ::lseqdb::SeekGetRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSeekGetStream(::grpc::ServerContext* context, ::lseqdb::SeekGetRequest* request, ::grpc::ServerAsyncWriter< ::lseqdb::DBItems>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(4, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetReplicaEventsStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetReplicaEventsStream() {
+      ::grpc::Service::MarkMethodAsync(5);
+    }
+    ~WithAsyncMethod_GetReplicaEventsStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetReplicaEventsStream(::grpc::ServerContext* /*context*/, const ::lseqdb::EventsRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetReplicaEventsStream(::grpc::ServerContext* context, ::lseqdb::EventsRequest* request, ::grpc::ServerAsyncWriter< ::lseqdb::DBItems>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(5, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_Watch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_Watch() {
+      ::grpc::Service::MarkMethodAsync(6);
+    }
+    ~WithAsyncMethod_Watch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Watch(::grpc::ServerContext* /*context*/, const ::lseqdb::WatchRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWatch(::grpc::ServerContext* context, ::lseqdb::WatchRequest* request, ::grpc::ServerAsyncWriter< ::lseqdb::DBItems>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(6, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_ScanRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ScanRange() {
+      ::grpc::Service::MarkMethodAsync(7);
+    }
+    ~WithAsyncMethod_ScanRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ScanRange(::grpc::ServerContext* /*context*/, const ::lseqdb::ScanRequest* /*request*/, ::lseqdb::DBItems* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestScanRange(::grpc::ServerContext* context, ::lseqdb::ScanRequest* request, ::grpc::ServerAsyncResponseWriter< ::lseqdb::DBItems>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_MultiGetValue : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_MultiGetValue() {
+      ::grpc::Service::MarkMethodAsync(8);
+    }
+    ~WithAsyncMethod_MultiGetValue() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MultiGetValue(::grpc::ServerContext* /*context*/, const ::lseqdb::MultiGetRequest* /*request*/, ::lseqdb::DBItems* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestMultiGetValue(::grpc::ServerContext* context, ::lseqdb::MultiGetRequest* request, ::grpc::ServerAsyncResponseWriter< ::lseqdb::DBItems>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithAsyncMethod_GetConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_GetConfig() {
-      ::grpc::Service::MarkMethodAsync(4);
+      ::grpc::Service::MarkMethodAsync(9);
     }
     ~WithAsyncMethod_GetConfig() override {
       BaseClassMustBeDerivedFromService(this);
@@ -346,7 +657,7 @@ class LSeqDatabase final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestGetConfig(::grpc::ServerContext* context, ::google::protobuf::Empty* request, ::grpc::ServerAsyncResponseWriter< ::lseqdb::Config>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -355,7 +666,7 @@ class LSeqDatabase final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_SyncGet_() {
-      ::grpc::Service::MarkMethodAsync(5);
+      ::grpc::Service::MarkMethodAsync(10);
     }
     ~WithAsyncMethod_SyncGet_() override {
       BaseClassMustBeDerivedFromService(this);
@@ -366,7 +677,7 @@ class LSeqDatabase final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestSyncGet_(::grpc::ServerContext* context, ::lseqdb::SyncGetRequest* request, ::grpc::ServerAsyncResponseWriter< ::lseqdb::LSeq>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -375,7 +686,7 @@ class LSeqDatabase final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithAsyncMethod_SyncPut_() {
-      ::grpc::Service::MarkMethodAsync(6);
+      ::grpc::Service::MarkMethodAsync(11);
     }
     ~WithAsyncMethod_SyncPut_() override {
       BaseClassMustBeDerivedFromService(this);
@@ -386,10 +697,50 @@ class LSeqDatabase final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestSyncPut_(::grpc::ServerContext* context, ::lseqdb::DBItems* request, ::grpc::ServerAsyncResponseWriter< ::google::protobuf::Empty>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SyncSeqs_ : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SyncSeqs_() {
+      ::grpc::Service::MarkMethodAsync(12);
+    }
+    ~WithAsyncMethod_SyncSeqs_() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncSeqs_(::grpc::ServerContext* /*context*/, const ::lseqdb::SeqVector* /*request*/, ::lseqdb::SeqVector* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSyncSeqs_(::grpc::ServerContext* context, ::lseqdb::SeqVector* request, ::grpc::ServerAsyncResponseWriter< ::lseqdb::SeqVector>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_SyncStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SyncStream() {
+      ::grpc::Service::MarkMethodAsync(13);
+    }
+    ~WithAsyncMethod_SyncStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::lseqdb::SyncAck, ::lseqdb::DBItems>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSyncStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::lseqdb::SyncAck, ::lseqdb::DBItems>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(13, context, stream, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_GetValue<WithAsyncMethod_Put<WithAsyncMethod_SeekGet<WithAsyncMethod_GetReplicaEvents<WithAsyncMethod_GetConfig<WithAsyncMethod_SyncGet_<WithAsyncMethod_SyncPut_<Service > > > > > > > AsyncService;
+  typedef WithAsyncMethod_GetValue<WithAsyncMethod_Put<WithAsyncMethod_SeekGet<WithAsyncMethod_GetReplicaEvents<WithAsyncMethod_SeekGetStream<WithAsyncMethod_GetReplicaEventsStream<WithAsyncMethod_Watch<WithAsyncMethod_ScanRange<WithAsyncMethod_MultiGetValue<WithAsyncMethod_GetConfig<WithAsyncMethod_SyncGet_<WithAsyncMethod_SyncPut_<WithAsyncMethod_SyncSeqs_<WithAsyncMethod_SyncStream<Service > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class WithCallbackMethod_GetValue : public BaseClass {
    private:
@@ -499,18 +850,138 @@ class LSeqDatabase final {
       ::grpc::CallbackServerContext* /*context*/, const ::lseqdb::EventsRequest* /*request*/, ::lseqdb::DBItems* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithCallbackMethod_SeekGetStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SeekGetStream() {
+      ::grpc::Service::MarkMethodCallback(4,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::lseqdb::SeekGetRequest, ::lseqdb::DBItems>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::lseqdb::SeekGetRequest* request) { return this->SeekGetStream(context, request); }));
+    }
+    ~WithCallbackMethod_SeekGetStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SeekGetStream(::grpc::ServerContext* /*context*/, const ::lseqdb::SeekGetRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::lseqdb::DBItems>* SeekGetStream(
+      ::grpc::CallbackServerContext* /*context*/, const ::lseqdb::SeekGetRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_GetReplicaEventsStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_GetReplicaEventsStream() {
+      ::grpc::Service::MarkMethodCallback(5,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::lseqdb::EventsRequest, ::lseqdb::DBItems>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::lseqdb::EventsRequest* request) { return this->GetReplicaEventsStream(context, request); }));
+    }
+    ~WithCallbackMethod_GetReplicaEventsStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetReplicaEventsStream(::grpc::ServerContext* /*context*/, const ::lseqdb::EventsRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::lseqdb::DBItems>* GetReplicaEventsStream(
+      ::grpc::CallbackServerContext* /*context*/, const ::lseqdb::EventsRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_Watch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_Watch() {
+      ::grpc::Service::MarkMethodCallback(6,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::lseqdb::WatchRequest, ::lseqdb::DBItems>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::lseqdb::WatchRequest* request) { return this->Watch(context, request); }));
+    }
+    ~WithCallbackMethod_Watch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Watch(::grpc::ServerContext* /*context*/, const ::lseqdb::WatchRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::lseqdb::DBItems>* Watch(
+      ::grpc::CallbackServerContext* /*context*/, const ::lseqdb::WatchRequest* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_ScanRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_ScanRange() {
+      ::grpc::Service::MarkMethodCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::lseqdb::ScanRequest, ::lseqdb::DBItems>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::lseqdb::ScanRequest* request, ::lseqdb::DBItems* response) { return this->ScanRange(context, request, response); }));}
+    void SetMessageAllocatorFor_ScanRange(
+        ::grpc::MessageAllocator< ::lseqdb::ScanRequest, ::lseqdb::DBItems>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(7);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::lseqdb::ScanRequest, ::lseqdb::DBItems>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_ScanRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ScanRange(::grpc::ServerContext* /*context*/, const ::lseqdb::ScanRequest* /*request*/, ::lseqdb::DBItems* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ScanRange(
+      ::grpc::CallbackServerContext* /*context*/, const ::lseqdb::ScanRequest* /*request*/, ::lseqdb::DBItems* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_MultiGetValue : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_MultiGetValue() {
+      ::grpc::Service::MarkMethodCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::lseqdb::MultiGetRequest, ::lseqdb::DBItems>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::lseqdb::MultiGetRequest* request, ::lseqdb::DBItems* response) { return this->MultiGetValue(context, request, response); }));}
+    void SetMessageAllocatorFor_MultiGetValue(
+        ::grpc::MessageAllocator< ::lseqdb::MultiGetRequest, ::lseqdb::DBItems>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(8);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::lseqdb::MultiGetRequest, ::lseqdb::DBItems>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_MultiGetValue() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MultiGetValue(::grpc::ServerContext* /*context*/, const ::lseqdb::MultiGetRequest* /*request*/, ::lseqdb::DBItems* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* MultiGetValue(
+      ::grpc::CallbackServerContext* /*context*/, const ::lseqdb::MultiGetRequest* /*request*/, ::lseqdb::DBItems* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithCallbackMethod_GetConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_GetConfig() {
-      ::grpc::Service::MarkMethodCallback(4,
+      ::grpc::Service::MarkMethodCallback(9,
           new ::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::lseqdb::Config>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::google::protobuf::Empty* request, ::lseqdb::Config* response) { return this->GetConfig(context, request, response); }));}
     void SetMessageAllocatorFor_GetConfig(
         ::grpc::MessageAllocator< ::google::protobuf::Empty, ::lseqdb::Config>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(4);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(9);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::google::protobuf::Empty, ::lseqdb::Config>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -531,13 +1002,13 @@ class LSeqDatabase final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_SyncGet_() {
-      ::grpc::Service::MarkMethodCallback(5,
+      ::grpc::Service::MarkMethodCallback(10,
           new ::grpc::internal::CallbackUnaryHandler< ::lseqdb::SyncGetRequest, ::lseqdb::LSeq>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::lseqdb::SyncGetRequest* request, ::lseqdb::LSeq* response) { return this->SyncGet_(context, request, response); }));}
     void SetMessageAllocatorFor_SyncGet_(
         ::grpc::MessageAllocator< ::lseqdb::SyncGetRequest, ::lseqdb::LSeq>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(5);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(10);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::lseqdb::SyncGetRequest, ::lseqdb::LSeq>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -558,13 +1029,13 @@ class LSeqDatabase final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithCallbackMethod_SyncPut_() {
-      ::grpc::Service::MarkMethodCallback(6,
+      ::grpc::Service::MarkMethodCallback(11,
           new ::grpc::internal::CallbackUnaryHandler< ::lseqdb::DBItems, ::google::protobuf::Empty>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::lseqdb::DBItems* request, ::google::protobuf::Empty* response) { return this->SyncPut_(context, request, response); }));}
     void SetMessageAllocatorFor_SyncPut_(
         ::grpc::MessageAllocator< ::lseqdb::DBItems, ::google::protobuf::Empty>* allocator) {
-      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(6);
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(11);
       static_cast<::grpc::internal::CallbackUnaryHandler< ::lseqdb::DBItems, ::google::protobuf::Empty>*>(handler)
               ->SetMessageAllocator(allocator);
     }
@@ -579,7 +1050,57 @@ class LSeqDatabase final {
     virtual ::grpc::ServerUnaryReactor* SyncPut_(
       ::grpc::CallbackServerContext* /*context*/, const ::lseqdb::DBItems* /*request*/, ::google::protobuf::Empty* /*response*/)  { return nullptr; }
   };
-  typedef WithCallbackMethod_GetValue<WithCallbackMethod_Put<WithCallbackMethod_SeekGet<WithCallbackMethod_GetReplicaEvents<WithCallbackMethod_GetConfig<WithCallbackMethod_SyncGet_<WithCallbackMethod_SyncPut_<Service > > > > > > > CallbackService;
+  template <class BaseClass>
+  class WithCallbackMethod_SyncSeqs_ : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SyncSeqs_() {
+      ::grpc::Service::MarkMethodCallback(12,
+          new ::grpc::internal::CallbackUnaryHandler< ::lseqdb::SeqVector, ::lseqdb::SeqVector>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::lseqdb::SeqVector* request, ::lseqdb::SeqVector* response) { return this->SyncSeqs_(context, request, response); }));}
+    void SetMessageAllocatorFor_SyncSeqs_(
+        ::grpc::MessageAllocator< ::lseqdb::SeqVector, ::lseqdb::SeqVector>* allocator) {
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(12);
+      static_cast<::grpc::internal::CallbackUnaryHandler< ::lseqdb::SeqVector, ::lseqdb::SeqVector>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~WithCallbackMethod_SyncSeqs_() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncSeqs_(::grpc::ServerContext* /*context*/, const ::lseqdb::SeqVector* /*request*/, ::lseqdb::SeqVector* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SyncSeqs_(
+      ::grpc::CallbackServerContext* /*context*/, const ::lseqdb::SeqVector* /*request*/, ::lseqdb::SeqVector* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithCallbackMethod_SyncStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithCallbackMethod_SyncStream() {
+      ::grpc::Service::MarkMethodCallback(13,
+          new ::grpc::internal::CallbackBidiHandler< ::lseqdb::DBItems, ::lseqdb::SyncAck>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->SyncStream(context); }));
+    }
+    ~WithCallbackMethod_SyncStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::lseqdb::SyncAck, ::lseqdb::DBItems>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::lseqdb::DBItems, ::lseqdb::SyncAck>* SyncStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  typedef WithCallbackMethod_GetValue<WithCallbackMethod_Put<WithCallbackMethod_SeekGet<WithCallbackMethod_GetReplicaEvents<WithCallbackMethod_SeekGetStream<WithCallbackMethod_GetReplicaEventsStream<WithCallbackMethod_Watch<WithCallbackMethod_ScanRange<WithCallbackMethod_MultiGetValue<WithCallbackMethod_GetConfig<WithCallbackMethod_SyncGet_<WithCallbackMethod_SyncPut_<WithCallbackMethod_SyncSeqs_<WithCallbackMethod_SyncStream<Service > > > > > > > > > > > > > > CallbackService;
   typedef CallbackService ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_GetValue : public BaseClass {
@@ -650,83 +1171,202 @@ class LSeqDatabase final {
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_GetConfig : public BaseClass {
+  class WithGenericMethod_SeekGetStream : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_GetConfig() {
+    WithGenericMethod_SeekGetStream() {
       ::grpc::Service::MarkMethodGeneric(4);
     }
-    ~WithGenericMethod_GetConfig() override {
+    ~WithGenericMethod_SeekGetStream() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetConfig(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::lseqdb::Config* /*response*/) override {
+    ::grpc::Status SeekGetStream(::grpc::ServerContext* /*context*/, const ::lseqdb::SeekGetRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_SyncGet_ : public BaseClass {
+  class WithGenericMethod_GetReplicaEventsStream : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SyncGet_() {
+    WithGenericMethod_GetReplicaEventsStream() {
       ::grpc::Service::MarkMethodGeneric(5);
     }
-    ~WithGenericMethod_SyncGet_() override {
+    ~WithGenericMethod_GetReplicaEventsStream() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SyncGet_(::grpc::ServerContext* /*context*/, const ::lseqdb::SyncGetRequest* /*request*/, ::lseqdb::LSeq* /*response*/) override {
+    ::grpc::Status GetReplicaEventsStream(::grpc::ServerContext* /*context*/, const ::lseqdb::EventsRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithGenericMethod_SyncPut_ : public BaseClass {
+  class WithGenericMethod_Watch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithGenericMethod_SyncPut_() {
+    WithGenericMethod_Watch() {
       ::grpc::Service::MarkMethodGeneric(6);
     }
-    ~WithGenericMethod_SyncPut_() override {
+    ~WithGenericMethod_Watch() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status SyncPut_(::grpc::ServerContext* /*context*/, const ::lseqdb::DBItems* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+    ::grpc::Status Watch(::grpc::ServerContext* /*context*/, const ::lseqdb::WatchRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
   };
   template <class BaseClass>
-  class WithRawMethod_GetValue : public BaseClass {
+  class WithGenericMethod_ScanRange : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_GetValue() {
-      ::grpc::Service::MarkMethodRaw(0);
+    WithGenericMethod_ScanRange() {
+      ::grpc::Service::MarkMethodGeneric(7);
     }
-    ~WithRawMethod_GetValue() override {
+    ~WithGenericMethod_ScanRange() override {
       BaseClassMustBeDerivedFromService(this);
     }
     // disable synchronous version of this method
-    ::grpc::Status GetValue(::grpc::ServerContext* /*context*/, const ::lseqdb::ReplicaKey* /*request*/, ::lseqdb::Value* /*response*/) override {
+    ::grpc::Status ScanRange(::grpc::ServerContext* /*context*/, const ::lseqdb::ScanRequest* /*request*/, ::lseqdb::DBItems* /*response*/) override {
       abort();
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
-    void RequestGetValue(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
-    }
   };
   template <class BaseClass>
-  class WithRawMethod_Put : public BaseClass {
+  class WithGenericMethod_MultiGetValue : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
-    WithRawMethod_Put() {
-      ::grpc::Service::MarkMethodRaw(1);
+    WithGenericMethod_MultiGetValue() {
+      ::grpc::Service::MarkMethodGeneric(8);
+    }
+    ~WithGenericMethod_MultiGetValue() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MultiGetValue(::grpc::ServerContext* /*context*/, const ::lseqdb::MultiGetRequest* /*request*/, ::lseqdb::DBItems* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetConfig : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetConfig() {
+      ::grpc::Service::MarkMethodGeneric(9);
+    }
+    ~WithGenericMethod_GetConfig() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetConfig(::grpc::ServerContext* /*context*/, const ::google::protobuf::Empty* /*request*/, ::lseqdb::Config* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SyncGet_ : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SyncGet_() {
+      ::grpc::Service::MarkMethodGeneric(10);
+    }
+    ~WithGenericMethod_SyncGet_() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncGet_(::grpc::ServerContext* /*context*/, const ::lseqdb::SyncGetRequest* /*request*/, ::lseqdb::LSeq* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SyncPut_ : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SyncPut_() {
+      ::grpc::Service::MarkMethodGeneric(11);
+    }
+    ~WithGenericMethod_SyncPut_() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncPut_(::grpc::ServerContext* /*context*/, const ::lseqdb::DBItems* /*request*/, ::google::protobuf::Empty* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SyncSeqs_ : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SyncSeqs_() {
+      ::grpc::Service::MarkMethodGeneric(12);
+    }
+    ~WithGenericMethod_SyncSeqs_() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncSeqs_(::grpc::ServerContext* /*context*/, const ::lseqdb::SeqVector* /*request*/, ::lseqdb::SeqVector* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_SyncStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SyncStream() {
+      ::grpc::Service::MarkMethodGeneric(13);
+    }
+    ~WithGenericMethod_SyncStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::lseqdb::SyncAck, ::lseqdb::DBItems>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetValue : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetValue() {
+      ::grpc::Service::MarkMethodRaw(0);
+    }
+    ~WithRawMethod_GetValue() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetValue(::grpc::ServerContext* /*context*/, const ::lseqdb::ReplicaKey* /*request*/, ::lseqdb::Value* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetValue(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(0, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Put : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Put() {
+      ::grpc::Service::MarkMethodRaw(1);
     }
     ~WithRawMethod_Put() override {
       BaseClassMustBeDerivedFromService(this);
@@ -781,12 +1421,112 @@ class LSeqDatabase final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_SeekGetStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SeekGetStream() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_SeekGetStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SeekGetStream(::grpc::ServerContext* /*context*/, const ::lseqdb::SeekGetRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSeekGetStream(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(4, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetReplicaEventsStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetReplicaEventsStream() {
+      ::grpc::Service::MarkMethodRaw(5);
+    }
+    ~WithRawMethod_GetReplicaEventsStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetReplicaEventsStream(::grpc::ServerContext* /*context*/, const ::lseqdb::EventsRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetReplicaEventsStream(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(5, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_Watch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_Watch() {
+      ::grpc::Service::MarkMethodRaw(6);
+    }
+    ~WithRawMethod_Watch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Watch(::grpc::ServerContext* /*context*/, const ::lseqdb::WatchRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestWatch(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(6, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_ScanRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ScanRange() {
+      ::grpc::Service::MarkMethodRaw(7);
+    }
+    ~WithRawMethod_ScanRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ScanRange(::grpc::ServerContext* /*context*/, const ::lseqdb::ScanRequest* /*request*/, ::lseqdb::DBItems* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestScanRange(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(7, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_MultiGetValue : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_MultiGetValue() {
+      ::grpc::Service::MarkMethodRaw(8);
+    }
+    ~WithRawMethod_MultiGetValue() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MultiGetValue(::grpc::ServerContext* /*context*/, const ::lseqdb::MultiGetRequest* /*request*/, ::lseqdb::DBItems* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestMultiGetValue(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(8, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_GetConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_GetConfig() {
-      ::grpc::Service::MarkMethodRaw(4);
+      ::grpc::Service::MarkMethodRaw(9);
     }
     ~WithRawMethod_GetConfig() override {
       BaseClassMustBeDerivedFromService(this);
@@ -797,7 +1537,7 @@ class LSeqDatabase final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestGetConfig(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(4, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(9, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -806,7 +1546,7 @@ class LSeqDatabase final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_SyncGet_() {
-      ::grpc::Service::MarkMethodRaw(5);
+      ::grpc::Service::MarkMethodRaw(10);
     }
     ~WithRawMethod_SyncGet_() override {
       BaseClassMustBeDerivedFromService(this);
@@ -817,7 +1557,7 @@ class LSeqDatabase final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestSyncGet_(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(5, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(10, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -826,7 +1566,7 @@ class LSeqDatabase final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawMethod_SyncPut_() {
-      ::grpc::Service::MarkMethodRaw(6);
+      ::grpc::Service::MarkMethodRaw(11);
     }
     ~WithRawMethod_SyncPut_() override {
       BaseClassMustBeDerivedFromService(this);
@@ -837,7 +1577,47 @@ class LSeqDatabase final {
       return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
     }
     void RequestSyncPut_(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
-      ::grpc::Service::RequestAsyncUnary(6, context, request, response, new_call_cq, notification_cq, tag);
+      ::grpc::Service::RequestAsyncUnary(11, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SyncSeqs_ : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SyncSeqs_() {
+      ::grpc::Service::MarkMethodRaw(12);
+    }
+    ~WithRawMethod_SyncSeqs_() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncSeqs_(::grpc::ServerContext* /*context*/, const ::lseqdb::SeqVector* /*request*/, ::lseqdb::SeqVector* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSyncSeqs_(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(12, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_SyncStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SyncStream() {
+      ::grpc::Service::MarkMethodRaw(13);
+    }
+    ~WithRawMethod_SyncStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::lseqdb::SyncAck, ::lseqdb::DBItems>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSyncStream(::grpc::ServerContext* context, ::grpc::ServerAsyncReaderWriter< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* stream, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncBidiStreaming(13, context, stream, new_call_cq, notification_cq, tag);
     }
   };
   template <class BaseClass>
@@ -929,12 +1709,122 @@ class LSeqDatabase final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_SeekGetStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SeekGetStream() {
+      ::grpc::Service::MarkMethodRawCallback(4,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->SeekGetStream(context, request); }));
+    }
+    ~WithRawCallbackMethod_SeekGetStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SeekGetStream(::grpc::ServerContext* /*context*/, const ::lseqdb::SeekGetRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* SeekGetStream(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_GetReplicaEventsStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_GetReplicaEventsStream() {
+      ::grpc::Service::MarkMethodRawCallback(5,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->GetReplicaEventsStream(context, request); }));
+    }
+    ~WithRawCallbackMethod_GetReplicaEventsStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetReplicaEventsStream(::grpc::ServerContext* /*context*/, const ::lseqdb::EventsRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* GetReplicaEventsStream(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_Watch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_Watch() {
+      ::grpc::Service::MarkMethodRawCallback(6,
+          new ::grpc::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const::grpc::ByteBuffer* request) { return this->Watch(context, request); }));
+    }
+    ~WithRawCallbackMethod_Watch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status Watch(::grpc::ServerContext* /*context*/, const ::lseqdb::WatchRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* Watch(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_ScanRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_ScanRange() {
+      ::grpc::Service::MarkMethodRawCallback(7,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->ScanRange(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_ScanRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ScanRange(::grpc::ServerContext* /*context*/, const ::lseqdb::ScanRequest* /*request*/, ::lseqdb::DBItems* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* ScanRange(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_MultiGetValue : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_MultiGetValue() {
+      ::grpc::Service::MarkMethodRawCallback(8,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->MultiGetValue(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_MultiGetValue() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status MultiGetValue(::grpc::ServerContext* /*context*/, const ::lseqdb::MultiGetRequest* /*request*/, ::lseqdb::DBItems* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* MultiGetValue(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
   class WithRawCallbackMethod_GetConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_GetConfig() {
-      ::grpc::Service::MarkMethodRawCallback(4,
+      ::grpc::Service::MarkMethodRawCallback(9,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetConfig(context, request, response); }));
@@ -956,7 +1846,7 @@ class LSeqDatabase final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_SyncGet_() {
-      ::grpc::Service::MarkMethodRawCallback(5,
+      ::grpc::Service::MarkMethodRawCallback(10,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SyncGet_(context, request, response); }));
@@ -978,7 +1868,7 @@ class LSeqDatabase final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithRawCallbackMethod_SyncPut_() {
-      ::grpc::Service::MarkMethodRawCallback(6,
+      ::grpc::Service::MarkMethodRawCallback(11,
           new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
             [this](
                    ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SyncPut_(context, request, response); }));
@@ -995,6 +1885,51 @@ class LSeqDatabase final {
       ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
   };
   template <class BaseClass>
+  class WithRawCallbackMethod_SyncSeqs_ : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SyncSeqs_() {
+      ::grpc::Service::MarkMethodRawCallback(12,
+          new ::grpc::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SyncSeqs_(context, request, response); }));
+    }
+    ~WithRawCallbackMethod_SyncSeqs_() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncSeqs_(::grpc::ServerContext* /*context*/, const ::lseqdb::SeqVector* /*request*/, ::lseqdb::SeqVector* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerUnaryReactor* SyncSeqs_(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)  { return nullptr; }
+  };
+  template <class BaseClass>
+  class WithRawCallbackMethod_SyncStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawCallbackMethod_SyncStream() {
+      ::grpc::Service::MarkMethodRawCallback(13,
+          new ::grpc::internal::CallbackBidiHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+                   ::grpc::CallbackServerContext* context) { return this->SyncStream(context); }));
+    }
+    ~WithRawCallbackMethod_SyncStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SyncStream(::grpc::ServerContext* /*context*/, ::grpc::ServerReaderWriter< ::lseqdb::SyncAck, ::lseqdb::DBItems>* /*stream*/)  override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    virtual ::grpc::ServerBidiReactor< ::grpc::ByteBuffer, ::grpc::ByteBuffer>* SyncStream(
+      ::grpc::CallbackServerContext* /*context*/)
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_GetValue : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -1103,12 +2038,66 @@ class LSeqDatabase final {
     virtual ::grpc::Status StreamedGetReplicaEvents(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::lseqdb::EventsRequest,::lseqdb::DBItems>* server_unary_streamer) = 0;
   };
   template <class BaseClass>
+  class WithStreamedUnaryMethod_ScanRange : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_ScanRange() {
+      ::grpc::Service::MarkMethodStreamed(7,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::lseqdb::ScanRequest, ::lseqdb::DBItems>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::lseqdb::ScanRequest, ::lseqdb::DBItems>* streamer) {
+                       return this->StreamedScanRange(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_ScanRange() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ScanRange(::grpc::ServerContext* /*context*/, const ::lseqdb::ScanRequest* /*request*/, ::lseqdb::DBItems* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedScanRange(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::lseqdb::ScanRequest,::lseqdb::DBItems>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_MultiGetValue : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_MultiGetValue() {
+      ::grpc::Service::MarkMethodStreamed(8,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::lseqdb::MultiGetRequest, ::lseqdb::DBItems>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::lseqdb::MultiGetRequest, ::lseqdb::DBItems>* streamer) {
+                       return this->StreamedMultiGetValue(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_MultiGetValue() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status MultiGetValue(::grpc::ServerContext* /*context*/, const ::lseqdb::MultiGetRequest* /*request*/, ::lseqdb::DBItems* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedMultiGetValue(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::lseqdb::MultiGetRequest,::lseqdb::DBItems>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_GetConfig : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_GetConfig() {
-      ::grpc::Service::MarkMethodStreamed(4,
+      ::grpc::Service::MarkMethodStreamed(9,
         new ::grpc::internal::StreamedUnaryHandler<
           ::google::protobuf::Empty, ::lseqdb::Config>(
             [this](::grpc::ServerContext* context,
@@ -1135,7 +2124,7 @@ class LSeqDatabase final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_SyncGet_() {
-      ::grpc::Service::MarkMethodStreamed(5,
+      ::grpc::Service::MarkMethodStreamed(10,
         new ::grpc::internal::StreamedUnaryHandler<
           ::lseqdb::SyncGetRequest, ::lseqdb::LSeq>(
             [this](::grpc::ServerContext* context,
@@ -1162,7 +2151,7 @@ class LSeqDatabase final {
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
    public:
     WithStreamedUnaryMethod_SyncPut_() {
-      ::grpc::Service::MarkMethodStreamed(6,
+      ::grpc::Service::MarkMethodStreamed(11,
         new ::grpc::internal::StreamedUnaryHandler<
           ::lseqdb::DBItems, ::google::protobuf::Empty>(
             [this](::grpc::ServerContext* context,
@@ -1183,9 +2172,117 @@ class LSeqDatabase final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedSyncPut_(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::lseqdb::DBItems,::google::protobuf::Empty>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_GetValue<WithStreamedUnaryMethod_Put<WithStreamedUnaryMethod_SeekGet<WithStreamedUnaryMethod_GetReplicaEvents<WithStreamedUnaryMethod_GetConfig<WithStreamedUnaryMethod_SyncGet_<WithStreamedUnaryMethod_SyncPut_<Service > > > > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_GetValue<WithStreamedUnaryMethod_Put<WithStreamedUnaryMethod_SeekGet<WithStreamedUnaryMethod_GetReplicaEvents<WithStreamedUnaryMethod_GetConfig<WithStreamedUnaryMethod_SyncGet_<WithStreamedUnaryMethod_SyncPut_<Service > > > > > > > StreamedService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_SyncSeqs_ : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_SyncSeqs_() {
+      ::grpc::Service::MarkMethodStreamed(12,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::lseqdb::SeqVector, ::lseqdb::SeqVector>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerUnaryStreamer<
+                     ::lseqdb::SeqVector, ::lseqdb::SeqVector>* streamer) {
+                       return this->StreamedSyncSeqs_(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SyncSeqs_() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SyncSeqs_(::grpc::ServerContext* /*context*/, const ::lseqdb::SeqVector* /*request*/, ::lseqdb::SeqVector* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSyncSeqs_(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::lseqdb::SeqVector,::lseqdb::SeqVector>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_GetValue<WithStreamedUnaryMethod_Put<WithStreamedUnaryMethod_SeekGet<WithStreamedUnaryMethod_GetReplicaEvents<WithStreamedUnaryMethod_ScanRange<WithStreamedUnaryMethod_MultiGetValue<WithStreamedUnaryMethod_GetConfig<WithStreamedUnaryMethod_SyncGet_<WithStreamedUnaryMethod_SyncPut_<WithStreamedUnaryMethod_SyncSeqs_<Service > > > > > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_SeekGetStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_SeekGetStream() {
+      ::grpc::Service::MarkMethodStreamed(4,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::lseqdb::SeekGetRequest, ::lseqdb::DBItems>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::lseqdb::SeekGetRequest, ::lseqdb::DBItems>* streamer) {
+                       return this->StreamedSeekGetStream(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_SeekGetStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SeekGetStream(::grpc::ServerContext* /*context*/, const ::lseqdb::SeekGetRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedSeekGetStream(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::lseqdb::SeekGetRequest,::lseqdb::DBItems>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_GetReplicaEventsStream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_GetReplicaEventsStream() {
+      ::grpc::Service::MarkMethodStreamed(5,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::lseqdb::EventsRequest, ::lseqdb::DBItems>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::lseqdb::EventsRequest, ::lseqdb::DBItems>* streamer) {
+                       return this->StreamedGetReplicaEventsStream(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_GetReplicaEventsStream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetReplicaEventsStream(::grpc::ServerContext* /*context*/, const ::lseqdb::EventsRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedGetReplicaEventsStream(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::lseqdb::EventsRequest,::lseqdb::DBItems>* server_split_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithSplitStreamingMethod_Watch : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_Watch() {
+      ::grpc::Service::MarkMethodStreamed(6,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::lseqdb::WatchRequest, ::lseqdb::DBItems>(
+            [this](::grpc::ServerContext* context,
+                   ::grpc::ServerSplitStreamer<
+                     ::lseqdb::WatchRequest, ::lseqdb::DBItems>* streamer) {
+                       return this->StreamedWatch(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_Watch() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status Watch(::grpc::ServerContext* /*context*/, const ::lseqdb::WatchRequest* /*request*/, ::grpc::ServerWriter< ::lseqdb::DBItems>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedWatch(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::lseqdb::WatchRequest,::lseqdb::DBItems>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_SeekGetStream<WithSplitStreamingMethod_GetReplicaEventsStream<WithSplitStreamingMethod_Watch<Service > > > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_GetValue<WithStreamedUnaryMethod_Put<WithStreamedUnaryMethod_SeekGet<WithStreamedUnaryMethod_GetReplicaEvents<WithSplitStreamingMethod_SeekGetStream<WithSplitStreamingMethod_GetReplicaEventsStream<WithSplitStreamingMethod_Watch<WithStreamedUnaryMethod_ScanRange<WithStreamedUnaryMethod_MultiGetValue<WithStreamedUnaryMethod_GetConfig<WithStreamedUnaryMethod_SyncGet_<WithStreamedUnaryMethod_SyncPut_<WithStreamedUnaryMethod_SyncSeqs_<Service > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace lseqdb
@@ -70,7 +70,8 @@ PROTOBUF_CONSTEXPR EventsRequest::EventsRequest(
   , /*decltype(_impl_.lseq_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.replica_id_)*/0
-  , /*decltype(_impl_.limit_)*/0u} {}
+  , /*decltype(_impl_.limit_)*/0u
+  , /*decltype(_impl_.chunk_bytes_)*/0u} {}
 struct EventsRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR EventsRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -80,10 +81,27 @@ struct EventsRequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EventsRequestDefaultTypeInternal _EventsRequest_default_instance_;
+PROTOBUF_CONSTEXPR WatchRequest::WatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.from_lseq_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.replica_id_)*/0} {}
+struct WatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR WatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~WatchRequestDefaultTypeInternal() {}
+  union {
+    WatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 WatchRequestDefaultTypeInternal _WatchRequest_default_instance_;
 PROTOBUF_CONSTEXPR PutRequest::PutRequest(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.value_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.durability_)*/0
   , /*decltype(_impl_._cached_size_)*/{}} {}
 struct PutRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR PutRequestDefaultTypeInternal()
@@ -100,7 +118,8 @@ PROTOBUF_CONSTEXPR SeekGetRequest::SeekGetRequest(
   , /*decltype(_impl_._cached_size_)*/{}
   , /*decltype(_impl_.lseq_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
   , /*decltype(_impl_.key_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
-  , /*decltype(_impl_.limit_)*/0u} {}
+  , /*decltype(_impl_.limit_)*/0u
+  , /*decltype(_impl_.chunk_bytes_)*/0u} {}
 struct SeekGetRequestDefaultTypeInternal {
   PROTOBUF_CONSTEXPR SeekGetRequestDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -110,6 +129,39 @@ struct SeekGetRequestDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SeekGetRequestDefaultTypeInternal _SeekGetRequest_default_instance_;
+PROTOBUF_CONSTEXPR ScanRequest::ScanRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.start_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.end_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.prefix_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.replica_id_)*/0
+  , /*decltype(_impl_.limit_)*/0u} {}
+struct ScanRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ScanRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ScanRequestDefaultTypeInternal() {}
+  union {
+    ScanRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ScanRequestDefaultTypeInternal _ScanRequest_default_instance_;
+PROTOBUF_CONSTEXPR MultiGetRequest::MultiGetRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_._has_bits_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_.keys_)*/{}
+  , /*decltype(_impl_.replica_id_)*/0} {}
+struct MultiGetRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR MultiGetRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~MultiGetRequestDefaultTypeInternal() {}
+  union {
+    MultiGetRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 MultiGetRequestDefaultTypeInternal _MultiGetRequest_default_instance_;
 PROTOBUF_CONSTEXPR DBItems_DbItem::DBItems_DbItem(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.lseq_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
@@ -139,6 +191,46 @@ struct DBItemsDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DBItemsDefaultTypeInternal _DBItems_default_instance_;
+PROTOBUF_CONSTEXPR SyncAck::SyncAck(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.applied_lseq_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SyncAckDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SyncAckDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SyncAckDefaultTypeInternal() {}
+  union {
+    SyncAck _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncAckDefaultTypeInternal _SyncAck_default_instance_;
+PROTOBUF_CONSTEXPR SeqVector_Entry::SeqVector_Entry(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.seq_)*/uint64_t{0u}
+  , /*decltype(_impl_.replica_id_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SeqVector_EntryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SeqVector_EntryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SeqVector_EntryDefaultTypeInternal() {}
+  union {
+    SeqVector_Entry _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SeqVector_EntryDefaultTypeInternal _SeqVector_Entry_default_instance_;
+PROTOBUF_CONSTEXPR SeqVector::SeqVector(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.entries_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SeqVectorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SeqVectorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SeqVectorDefaultTypeInternal() {}
+  union {
+    SeqVector _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SeqVectorDefaultTypeInternal _SeqVector_default_instance_;
 PROTOBUF_CONSTEXPR Config::Config(
     ::_pbi::ConstantInitialized): _impl_{
     /*decltype(_impl_.self_replica_id_)*/0
@@ -167,8 +259,8 @@ struct SyncGetRequestDefaultTypeInternal {
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SyncGetRequestDefaultTypeInternal _SyncGetRequest_default_instance_;
 }  // namespace lseqdb
-static ::_pb::Metadata file_level_metadata_lseqDb_2eproto[10];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_lseqDb_2eproto = nullptr;
+static ::_pb::Metadata file_level_metadata_lseqDb_2eproto[16];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_lseqDb_2eproto[1];
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_lseqDb_2eproto = nullptr;
 
 const uint32_t TableStruct_lseqDb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
@@ -207,10 +299,24 @@ const uint32_t TableStruct_lseqDb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::lseqdb::EventsRequest, _impl_.lseq_),
   PROTOBUF_FIELD_OFFSET(::lseqdb::EventsRequest, _impl_.key_),
   PROTOBUF_FIELD_OFFSET(::lseqdb::EventsRequest, _impl_.limit_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::EventsRequest, _impl_.chunk_bytes_),
   ~0u,
   0,
   1,
   2,
+  3,
+  PROTOBUF_FIELD_OFFSET(::lseqdb::WatchRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::WatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lseqdb::WatchRequest, _impl_.replica_id_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::WatchRequest, _impl_.from_lseq_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::WatchRequest, _impl_.key_),
+  ~0u,
+  0,
+  1,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::lseqdb::PutRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -219,6 +325,7 @@ const uint32_t TableStruct_lseqDb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::lseqdb::PutRequest, _impl_.key_),
   PROTOBUF_FIELD_OFFSET(::lseqdb::PutRequest, _impl_.value_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::PutRequest, _impl_.durability_),
   PROTOBUF_FIELD_OFFSET(::lseqdb::SeekGetRequest, _impl_._has_bits_),
   PROTOBUF_FIELD_OFFSET(::lseqdb::SeekGetRequest, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -228,9 +335,37 @@ const uint32_t TableStruct_lseqDb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::lseqdb::SeekGetRequest, _impl_.lseq_),
   PROTOBUF_FIELD_OFFSET(::lseqdb::SeekGetRequest, _impl_.key_),
   PROTOBUF_FIELD_OFFSET(::lseqdb::SeekGetRequest, _impl_.limit_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::SeekGetRequest, _impl_.chunk_bytes_),
+  ~0u,
+  0,
+  1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::lseqdb::ScanRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::ScanRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lseqdb::ScanRequest, _impl_.start_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::ScanRequest, _impl_.end_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::ScanRequest, _impl_.prefix_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::ScanRequest, _impl_.replica_id_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::ScanRequest, _impl_.limit_),
+  ~0u,
   ~0u,
   0,
   1,
+  2,
+  PROTOBUF_FIELD_OFFSET(::lseqdb::MultiGetRequest, _impl_._has_bits_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::MultiGetRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lseqdb::MultiGetRequest, _impl_.keys_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::MultiGetRequest, _impl_.replica_id_),
+  ~0u,
+  0,
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::lseqdb::DBItems_DbItem, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -249,6 +384,28 @@ const uint32_t TableStruct_lseqDb_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(p
   PROTOBUF_FIELD_OFFSET(::lseqdb::DBItems, _impl_.items_),
   PROTOBUF_FIELD_OFFSET(::lseqdb::DBItems, _impl_.replica_id_),
   ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lseqdb::SyncAck, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lseqdb::SyncAck, _impl_.applied_lseq_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lseqdb::SeqVector_Entry, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lseqdb::SeqVector_Entry, _impl_.replica_id_),
+  PROTOBUF_FIELD_OFFSET(::lseqdb::SeqVector_Entry, _impl_.seq_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::lseqdb::SeqVector, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::lseqdb::SeqVector, _impl_.entries_),
+  ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::lseqdb::Config, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
@@ -268,13 +425,19 @@ static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protode
   { 0, 8, -1, sizeof(::lseqdb::ReplicaKey)},
   { 10, -1, -1, sizeof(::lseqdb::Value)},
   { 18, -1, -1, sizeof(::lseqdb::LSeq)},
-  { 25, 35, -1, sizeof(::lseqdb::EventsRequest)},
-  { 39, -1, -1, sizeof(::lseqdb::PutRequest)},
-  { 47, 56, -1, sizeof(::lseqdb::SeekGetRequest)},
-  { 59, -1, -1, sizeof(::lseqdb::DBItems_DbItem)},
-  { 68, -1, -1, sizeof(::lseqdb::DBItems)},
-  { 76, -1, -1, sizeof(::lseqdb::Config)},
-  { 84, -1, -1, sizeof(::lseqdb::SyncGetRequest)},
+  { 25, 36, -1, sizeof(::lseqdb::EventsRequest)},
+  { 41, 50, -1, sizeof(::lseqdb::WatchRequest)},
+  { 53, -1, -1, sizeof(::lseqdb::PutRequest)},
+  { 62, 72, -1, sizeof(::lseqdb::SeekGetRequest)},
+  { 76, 87, -1, sizeof(::lseqdb::ScanRequest)},
+  { 92, 100, -1, sizeof(::lseqdb::MultiGetRequest)},
+  { 102, -1, -1, sizeof(::lseqdb::DBItems_DbItem)},
+  { 111, -1, -1, sizeof(::lseqdb::DBItems)},
+  { 119, -1, -1, sizeof(::lseqdb::SyncAck)},
+  { 126, -1, -1, sizeof(::lseqdb::SeqVector_Entry)},
+  { 134, -1, -1, sizeof(::lseqdb::SeqVector)},
+  { 141, -1, -1, sizeof(::lseqdb::Config)},
+  { 149, -1, -1, sizeof(::lseqdb::SyncGetRequest)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
@@ -282,10 +445,16 @@ static const ::_pb::Message* const file_default_instances[] = {
   &::lseqdb::_Value_default_instance_._instance,
   &::lseqdb::_LSeq_default_instance_._instance,
   &::lseqdb::_EventsRequest_default_instance_._instance,
+  &::lseqdb::_WatchRequest_default_instance_._instance,
   &::lseqdb::_PutRequest_default_instance_._instance,
   &::lseqdb::_SeekGetRequest_default_instance_._instance,
+  &::lseqdb::_ScanRequest_default_instance_._instance,
+  &::lseqdb::_MultiGetRequest_default_instance_._instance,
   &::lseqdb::_DBItems_DbItem_default_instance_._instance,
   &::lseqdb::_DBItems_default_instance_._instance,
+  &::lseqdb::_SyncAck_default_instance_._instance,
+  &::lseqdb::_SeqVector_Entry_default_instance_._instance,
+  &::lseqdb::_SeqVector_default_instance_._instance,
   &::lseqdb::_Config_default_instance_._instance,
   &::lseqdb::_SyncGetRequest_default_instance_._instance,
 };
@@ -294,39 +463,66 @@ const char descriptor_table_protodef_lseqDb_2eproto[] PROTOBUF_SECTION_VARIABLE(
   "\n\014lseqDb.proto\022\006lseqdb\032\033google/protobuf/"
   "empty.proto\"A\n\nReplicaKey\022\013\n\003key\030\001 \001(\t\022\027"
   "\n\nreplica_id\030\002 \001(\005H\000\210\001\001B\r\n\013_replica_id\"$"
-  "\n\005Value\022\r\n\005value\030\001 \001(\t\022\014\n\004lseq\030\002 \001(\t\"\024\n\004"
-  "LSeq\022\014\n\004lseq\030\001 \001(\t\"w\n\rEventsRequest\022\022\n\nr"
-  "eplica_id\030\001 \001(\005\022\021\n\004lseq\030\002 \001(\tH\000\210\001\001\022\020\n\003ke"
-  "y\030\003 \001(\tH\001\210\001\001\022\022\n\005limit\030\004 \001(\rH\002\210\001\001B\007\n\005_lse"
-  "qB\006\n\004_keyB\010\n\006_limit\"(\n\nPutRequest\022\013\n\003key"
-  "\030\001 \001(\t\022\r\n\005value\030\002 \001(\t\"V\n\016SeekGetRequest\022"
-  "\014\n\004lseq\030\001 \001(\t\022\020\n\003key\030\002 \001(\tH\000\210\001\001\022\022\n\005limit"
-  "\030\003 \001(\rH\001\210\001\001B\006\n\004_keyB\010\n\006_limit\"x\n\007DBItems"
-  "\022%\n\005items\030\001 \003(\0132\026.lseqdb.DBItems.DbItem\022"
-  "\022\n\nreplica_id\030\002 \001(\005\0322\n\006DbItem\022\014\n\004lseq\030\001 "
-  "\001(\t\022\013\n\003key\030\002 \001(\t\022\r\n\005value\030\003 \001(\t\"9\n\006Confi"
-  "g\022\027\n\017self_replica_id\030\001 \001(\005\022\026\n\016max_replic"
-  "a_id\030\002 \001(\005\"$\n\016SyncGetRequest\022\022\n\nreplica_"
-  "id\030\001 \001(\0052\200\003\n\014LSeqDatabase\022/\n\010GetValue\022\022."
-  "lseqdb.ReplicaKey\032\r.lseqdb.Value\"\000\022)\n\003Pu"
-  "t\022\022.lseqdb.PutRequest\032\014.lseqdb.LSeq\"\000\0224\n"
-  "\007SeekGet\022\026.lseqdb.SeekGetRequest\032\017.lseqd"
-  "b.DBItems\"\000\022<\n\020GetReplicaEvents\022\025.lseqdb"
-  ".EventsRequest\032\017.lseqdb.DBItems\"\000\0225\n\tGet"
-  "Config\022\026.google.protobuf.Empty\032\016.lseqdb."
-  "Config\"\000\0222\n\010SyncGet_\022\026.lseqdb.SyncGetReq"
-  "uest\032\014.lseqdb.LSeq\"\000\0225\n\010SyncPut_\022\017.lseqd"
-  "b.DBItems\032\026.google.protobuf.Empty\"\000b\006pro"
-  "to3"
+  "\n\005Value\022\r\n\005value\030\001 \001(\t\022\014\n\004lseq\030\002 \001(\014\"\024\n\004"
+  "LSeq\022\014\n\004lseq\030\001 \001(\014\"\241\001\n\rEventsRequest\022\022\n\n"
+  "replica_id\030\001 \001(\005\022\021\n\004lseq\030\002 \001(\014H\000\210\001\001\022\020\n\003k"
+  "ey\030\003 \001(\tH\001\210\001\001\022\022\n\005limit\030\004 \001(\rH\002\210\001\001\022\030\n\013chu"
+  "nk_bytes\030\005 \001(\rH\003\210\001\001B\007\n\005_lseqB\006\n\004_keyB\010\n\006"
+  "_limitB\016\n\014_chunk_bytes\"b\n\014WatchRequest\022\022"
+  "\n\nreplica_id\030\001 \001(\005\022\026\n\tfrom_lseq\030\002 \001(\014H\000\210"
+  "\001\001\022\020\n\003key\030\003 \001(\tH\001\210\001\001B\014\n\n_from_lseqB\006\n\004_k"
+  "ey\"P\n\nPutRequest\022\013\n\003key\030\001 \001(\t\022\r\n\005value\030\002"
+  " \001(\t\022&\n\ndurability\030\003 \001(\0162\022.lseqdb.Durabi"
+  "lity\"\200\001\n\016SeekGetRequest\022\014\n\004lseq\030\001 \001(\014\022\020\n"
+  "\003key\030\002 \001(\tH\000\210\001\001\022\022\n\005limit\030\003 \001(\rH\001\210\001\001\022\030\n\013c"
+  "hunk_bytes\030\004 \001(\rH\002\210\001\001B\006\n\004_keyB\010\n\006_limitB"
+  "\016\n\014_chunk_bytes\"\217\001\n\013ScanRequest\022\r\n\005start"
+  "\030\001 \001(\t\022\013\n\003end\030\002 \001(\t\022\023\n\006prefix\030\003 \001(\tH\000\210\001\001"
+  "\022\027\n\nreplica_id\030\004 \001(\005H\001\210\001\001\022\022\n\005limit\030\005 \001(\r"
+  "H\002\210\001\001B\t\n\007_prefixB\r\n\013_replica_idB\010\n\006_limi"
+  "t\"G\n\017MultiGetRequest\022\014\n\004keys\030\001 \003(\t\022\027\n\nre"
+  "plica_id\030\002 \001(\005H\000\210\001\001B\r\n\013_replica_id\"x\n\007DB"
+  "Items\022%\n\005items\030\001 \003(\0132\026.lseqdb.DBItems.Db"
+  "Item\022\022\n\nreplica_id\030\002 \001(\005\0322\n\006DbItem\022\014\n\004ls"
+  "eq\030\001 \001(\014\022\013\n\003key\030\002 \001(\014\022\r\n\005value\030\003 \001(\t\"\037\n\007"
+  "SyncAck\022\024\n\014applied_lseq\030\001 \001(\014\"_\n\tSeqVect"
+  "or\022(\n\007entries\030\001 \003(\0132\027.lseqdb.SeqVector.E"
+  "ntry\032(\n\005Entry\022\022\n\nreplica_id\030\001 \001(\005\022\013\n\003seq"
+  "\030\002 \001(\004\"9\n\006Config\022\027\n\017self_replica_id\030\001 \001("
+  "\005\022\026\n\016max_replica_id\030\002 \001(\005\"$\n\016SyncGetRequ"
+  "est\022\022\n\nreplica_id\030\001 \001(\005*i\n\nDurability\022\026\n"
+  "\022DURABILITY_DEFAULT\020\000\022\023\n\017DURABILITY_NONE"
+  "\020\001\022\027\n\023DURABILITY_PERIODIC\020\002\022\025\n\021DURABILIT"
+  "Y_ALWAYS\020\0032\225\006\n\014LSeqDatabase\022/\n\010GetValue\022"
+  "\022.lseqdb.ReplicaKey\032\r.lseqdb.Value\"\000\022)\n\003"
+  "Put\022\022.lseqdb.PutRequest\032\014.lseqdb.LSeq\"\000\022"
+  "4\n\007SeekGet\022\026.lseqdb.SeekGetRequest\032\017.lse"
+  "qdb.DBItems\"\000\022<\n\020GetReplicaEvents\022\025.lseq"
+  "db.EventsRequest\032\017.lseqdb.DBItems\"\000\022<\n\rS"
+  "eekGetStream\022\026.lseqdb.SeekGetRequest\032\017.l"
+  "seqdb.DBItems\"\0000\001\022D\n\026GetReplicaEventsStr"
+  "eam\022\025.lseqdb.EventsRequest\032\017.lseqdb.DBIt"
+  "ems\"\0000\001\0222\n\005Watch\022\024.lseqdb.WatchRequest\032\017"
+  ".lseqdb.DBItems\"\0000\001\0223\n\tScanRange\022\023.lseqd"
+  "b.ScanRequest\032\017.lseqdb.DBItems\"\000\022;\n\rMult"
+  "iGetValue\022\027.lseqdb.MultiGetRequest\032\017.lse"
+  "qdb.DBItems\"\000\0225\n\tGetConfig\022\026.google.prot"
+  "obuf.Empty\032\016.lseqdb.Config\"\000\0222\n\010SyncGet_"
+  "\022\026.lseqdb.SyncGetRequest\032\014.lseqdb.LSeq\"\000"
+  "\0225\n\010SyncPut_\022\017.lseqdb.DBItems\032\026.google.p"
+  "rotobuf.Empty\"\000\0223\n\tSyncSeqs_\022\021.lseqdb.Se"
+  "qVector\032\021.lseqdb.SeqVector\"\000\0224\n\nSyncStre"
+  "am\022\017.lseqdb.DBItems\032\017.lseqdb.SyncAck\"\000(\001"
+  "0\001b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_lseqDb_2eproto_deps[1] = {
   &::descriptor_table_google_2fprotobuf_2fempty_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_lseqDb_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_lseqDb_2eproto = {
-    false, false, 1043, descriptor_table_protodef_lseqDb_2eproto,
+    false, false, 2130, descriptor_table_protodef_lseqDb_2eproto,
     "lseqDb.proto",
-    &descriptor_table_lseqDb_2eproto_once, descriptor_table_lseqDb_2eproto_deps, 1, 10,
+    &descriptor_table_lseqDb_2eproto_once, descriptor_table_lseqDb_2eproto_deps, 1, 16,
     schemas, file_default_instances, TableStruct_lseqDb_2eproto::offsets,
     file_level_metadata_lseqDb_2eproto, file_level_enum_descriptors_lseqDb_2eproto,
     file_level_service_descriptors_lseqDb_2eproto,
@@ -338,6 +534,22 @@ PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_lseqDb_2
 // Force running AddDescriptors() at dynamic initialization time.
 PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_lseqDb_2eproto(&descriptor_table_lseqDb_2eproto);
 namespace lseqdb {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Durability_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_lseqDb_2eproto);
+  return file_level_enum_descriptors_lseqDb_2eproto[0];
+}
+bool Durability_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
 
 // ===================================================================
 
@@ -686,13 +898,12 @@ const char* Value::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
-      // string lseq = 2;
+      // bytes lseq = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_lseq();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.Value.lseq"));
         } else
           goto handle_unusual;
         continue;
@@ -735,13 +946,9 @@ uint8_t* Value::_InternalSerialize(
         1, this->_internal_value(), target);
   }
 
-  // string lseq = 2;
+  // bytes lseq = 2;
   if (!this->_internal_lseq().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_lseq().data(), static_cast<int>(this->_internal_lseq().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "lseqdb.Value.lseq");
-    target = stream->WriteStringMaybeAliased(
+    target = stream->WriteBytesMaybeAliased(
         2, this->_internal_lseq(), target);
   }
 
@@ -768,10 +975,10 @@ size_t Value::ByteSizeLong() const {
         this->_internal_value());
   }
 
-  // string lseq = 2;
+  // bytes lseq = 2;
   if (!this->_internal_lseq().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_lseq());
   }
 
@@ -913,13 +1120,12 @@ const char* LSeq::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string lseq = 1;
+      // bytes lseq = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           auto str = _internal_mutable_lseq();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.LSeq.lseq"));
         } else
           goto handle_unusual;
         continue;
@@ -952,13 +1158,9 @@ uint8_t* LSeq::_InternalSerialize(
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string lseq = 1;
+  // bytes lseq = 1;
   if (!this->_internal_lseq().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_lseq().data(), static_cast<int>(this->_internal_lseq().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "lseqdb.LSeq.lseq");
-    target = stream->WriteStringMaybeAliased(
+    target = stream->WriteBytesMaybeAliased(
         1, this->_internal_lseq(), target);
   }
 
@@ -978,10 +1180,10 @@ size_t LSeq::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string lseq = 1;
+  // bytes lseq = 1;
   if (!this->_internal_lseq().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
         this->_internal_lseq());
   }
 
@@ -1051,6 +1253,9 @@ class EventsRequest::_Internal {
   static void set_has_limit(HasBits* has_bits) {
     (*has_bits)[0] |= 4u;
   }
+  static void set_has_chunk_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
 };
 
 EventsRequest::EventsRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -1068,7 +1273,8 @@ EventsRequest::EventsRequest(const EventsRequest& from)
     , decltype(_impl_.lseq_){}
     , decltype(_impl_.key_){}
     , decltype(_impl_.replica_id_){}
-    , decltype(_impl_.limit_){}};
+    , decltype(_impl_.limit_){}
+    , decltype(_impl_.chunk_bytes_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   _impl_.lseq_.InitDefault();
@@ -1088,8 +1294,8 @@ EventsRequest::EventsRequest(const EventsRequest& from)
       _this->GetArenaForAllocation());
   }
   ::memcpy(&_impl_.replica_id_, &from._impl_.replica_id_,
-    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.limit_) -
-    reinterpret_cast<char*>(&_impl_.replica_id_)) + sizeof(_impl_.limit_));
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.chunk_bytes_) -
+    reinterpret_cast<char*>(&_impl_.replica_id_)) + sizeof(_impl_.chunk_bytes_));
   // @@protoc_insertion_point(copy_constructor:lseqdb.EventsRequest)
 }
 
@@ -1104,6 +1310,7 @@ inline void EventsRequest::SharedCtor(
     , decltype(_impl_.key_){}
     , decltype(_impl_.replica_id_){0}
     , decltype(_impl_.limit_){0u}
+    , decltype(_impl_.chunk_bytes_){0u}
   };
   _impl_.lseq_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -1150,7 +1357,11 @@ void EventsRequest::Clear() {
     }
   }
   _impl_.replica_id_ = 0;
-  _impl_.limit_ = 0u;
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&_impl_.limit_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.chunk_bytes_) -
+        reinterpret_cast<char*>(&_impl_.limit_)) + sizeof(_impl_.chunk_bytes_));
+  }
   _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
@@ -1170,13 +1381,12 @@ const char* EventsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
-      // optional string lseq = 2;
+      // optional bytes lseq = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
           auto str = _internal_mutable_lseq();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.EventsRequest.lseq"));
         } else
           goto handle_unusual;
         continue;
@@ -1199,6 +1409,15 @@ const char* EventsRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext*
         } else
           goto handle_unusual;
         continue;
+      // optional uint32 chunk_bytes = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_chunk_bytes(&has_bits);
+          _impl_.chunk_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1235,13 +1454,9 @@ uint8_t* EventsRequest::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_replica_id(), target);
   }
 
-  // optional string lseq = 2;
+  // optional bytes lseq = 2;
   if (_internal_has_lseq()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_lseq().data(), static_cast<int>(this->_internal_lseq().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "lseqdb.EventsRequest.lseq");
-    target = stream->WriteStringMaybeAliased(
+    target = stream->WriteBytesMaybeAliased(
         2, this->_internal_lseq(), target);
   }
 
@@ -1261,6 +1476,12 @@ uint8_t* EventsRequest::_InternalSerialize(
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_limit(), target);
   }
 
+  // optional uint32 chunk_bytes = 5;
+  if (_internal_has_chunk_bytes()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_chunk_bytes(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1279,10 +1500,10 @@ size_t EventsRequest::ByteSizeLong() const {
 
   cached_has_bits = _impl_._has_bits_[0];
   if (cached_has_bits & 0x00000003u) {
-    // optional string lseq = 2;
+    // optional bytes lseq = 2;
     if (cached_has_bits & 0x00000001u) {
       total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
           this->_internal_lseq());
     }
 
@@ -1299,11 +1520,18 @@ size_t EventsRequest::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
   }
 
-  // optional uint32 limit = 4;
-  if (cached_has_bits & 0x00000004u) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_limit());
-  }
+  if (cached_has_bits & 0x0000000cu) {
+    // optional uint32 limit = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_limit());
+    }
 
+    // optional uint32 chunk_bytes = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chunk_bytes());
+    }
+
+  }
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
@@ -1334,8 +1562,14 @@ void EventsRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::
   if (from._internal_replica_id() != 0) {
     _this->_internal_set_replica_id(from._internal_replica_id());
   }
-  if (cached_has_bits & 0x00000004u) {
-    _this->_internal_set_limit(from._internal_limit());
+  if (cached_has_bits & 0x0000000cu) {
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.limit_ = from._impl_.limit_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _this->_impl_.chunk_bytes_ = from._impl_.chunk_bytes_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
@@ -1366,8 +1600,8 @@ void EventsRequest::InternalSwap(EventsRequest* other) {
       &other->_impl_.key_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(EventsRequest, _impl_.limit_)
-      + sizeof(EventsRequest::_impl_.limit_)
+      PROTOBUF_FIELD_OFFSET(EventsRequest, _impl_.chunk_bytes_)
+      + sizeof(EventsRequest::_impl_.chunk_bytes_)
       - PROTOBUF_FIELD_OFFSET(EventsRequest, _impl_.replica_id_)>(
           reinterpret_cast<char*>(&_impl_.replica_id_),
           reinterpret_cast<char*>(&other->_impl_.replica_id_));
@@ -1381,65 +1615,77 @@ void EventsRequest::InternalSwap(EventsRequest* other) {
 
 // ===================================================================
 
-class PutRequest::_Internal {
+class WatchRequest::_Internal {
  public:
+  using HasBits = decltype(std::declval<WatchRequest>()._impl_._has_bits_);
+  static void set_has_from_lseq(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
-PutRequest::PutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+WatchRequest::WatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:lseqdb.PutRequest)
+  // @@protoc_insertion_point(arena_constructor:lseqdb.WatchRequest)
 }
-PutRequest::PutRequest(const PutRequest& from)
+WatchRequest::WatchRequest(const WatchRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  PutRequest* const _this = this; (void)_this;
+  WatchRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.key_){}
-    , decltype(_impl_.value_){}
-    , /*decltype(_impl_._cached_size_)*/{}};
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.from_lseq_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.replica_id_){}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.key_.InitDefault();
+  _impl_.from_lseq_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.key_.Set("", GetArenaForAllocation());
+    _impl_.from_lseq_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_key().empty()) {
-    _this->_impl_.key_.Set(from._internal_key(), 
+  if (from._internal_has_from_lseq()) {
+    _this->_impl_.from_lseq_.Set(from._internal_from_lseq(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.value_.InitDefault();
+  _impl_.key_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.value_.Set("", GetArenaForAllocation());
+    _impl_.key_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_value().empty()) {
-    _this->_impl_.value_.Set(from._internal_value(), 
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
       _this->GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:lseqdb.PutRequest)
+  _this->_impl_.replica_id_ = from._impl_.replica_id_;
+  // @@protoc_insertion_point(copy_constructor:lseqdb.WatchRequest)
 }
 
-inline void PutRequest::SharedCtor(
+inline void WatchRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.key_){}
-    , decltype(_impl_.value_){}
+      decltype(_impl_._has_bits_){}
     , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.from_lseq_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.replica_id_){0}
   };
-  _impl_.key_.InitDefault();
+  _impl_.from_lseq_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.key_.Set("", GetArenaForAllocation());
+    _impl_.from_lseq_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.value_.InitDefault();
+  _impl_.key_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.value_.Set("", GetArenaForAllocation());
+    _impl_.key_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-PutRequest::~PutRequest() {
-  // @@protoc_insertion_point(destructor:lseqdb.PutRequest)
+WatchRequest::~WatchRequest() {
+  // @@protoc_insertion_point(destructor:lseqdb.WatchRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1447,50 +1693,67 @@ PutRequest::~PutRequest() {
   SharedDtor();
 }
 
-inline void PutRequest::SharedDtor() {
+inline void WatchRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.from_lseq_.Destroy();
   _impl_.key_.Destroy();
-  _impl_.value_.Destroy();
 }
 
-void PutRequest::SetCachedSize(int size) const {
+void WatchRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void PutRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:lseqdb.PutRequest)
+void WatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:lseqdb.WatchRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.key_.ClearToEmpty();
-  _impl_.value_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _impl_.from_lseq_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _impl_.key_.ClearNonDefaultToEmpty();
+    }
+  }
+  _impl_.replica_id_ = 0;
+  _impl_._has_bits_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* PutRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* WatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string key = 1;
+      // int32 replica_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_key();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.PutRequest.key"));
         } else
           goto handle_unusual;
         continue;
-      // string value = 2;
+      // optional bytes from_lseq = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_value();
+          auto str = _internal_mutable_from_lseq();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.PutRequest.value"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string key = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.WatchRequest.key"));
         } else
           goto handle_unusual;
         continue;
@@ -1510,6 +1773,7 @@ const char* PutRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ct
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -1517,116 +1781,134 @@ failure:
 #undef CHK_
 }
 
-uint8_t* PutRequest::_InternalSerialize(
+uint8_t* WatchRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.PutRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.WatchRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string key = 1;
-  if (!this->_internal_key().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "lseqdb.PutRequest.key");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_key(), target);
+  // int32 replica_id = 1;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_replica_id(), target);
   }
 
-  // string value = 2;
-  if (!this->_internal_value().empty()) {
+  // optional bytes from_lseq = 2;
+  if (_internal_has_from_lseq()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_from_lseq(), target);
+  }
+
+  // optional string key = 3;
+  if (_internal_has_key()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "lseqdb.PutRequest.value");
+      "lseqdb.WatchRequest.key");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_value(), target);
+        3, this->_internal_key(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.PutRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.WatchRequest)
   return target;
 }
 
-size_t PutRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:lseqdb.PutRequest)
+size_t WatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lseqdb.WatchRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string key = 1;
-  if (!this->_internal_key().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_key());
-  }
-
-  // string value = 2;
-  if (!this->_internal_value().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_value());
-  }
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional bytes from_lseq = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_from_lseq());
+    }
 
-  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
-}
+    // optional string key = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_key());
+    }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PutRequest::_class_data_ = {
+  }
+  // int32 replica_id = 1;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData WatchRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    PutRequest::MergeImpl
+    WatchRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PutRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*WatchRequest::GetClassData() const { return &_class_data_; }
 
 
-void PutRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<PutRequest*>(&to_msg);
-  auto& from = static_cast<const PutRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.PutRequest)
+void WatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<WatchRequest*>(&to_msg);
+  auto& from = static_cast<const WatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.WatchRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_key().empty()) {
-    _this->_internal_set_key(from._internal_key());
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_from_lseq(from._internal_from_lseq());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_internal_set_key(from._internal_key());
+    }
   }
-  if (!from._internal_value().empty()) {
-    _this->_internal_set_value(from._internal_value());
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void PutRequest::CopyFrom(const PutRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.PutRequest)
+void WatchRequest::CopyFrom(const WatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.WatchRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool PutRequest::IsInitialized() const {
+bool WatchRequest::IsInitialized() const {
   return true;
 }
 
-void PutRequest::InternalSwap(PutRequest* other) {
+void WatchRequest::InternalSwap(WatchRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.key_, lhs_arena,
-      &other->_impl_.key_, rhs_arena
+      &_impl_.from_lseq_, lhs_arena,
+      &other->_impl_.from_lseq_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.value_, lhs_arena,
-      &other->_impl_.value_, rhs_arena
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
   );
+  swap(_impl_.replica_id_, other->_impl_.replica_id_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata PutRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata WatchRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_lseqDb_2eproto_getter, &descriptor_table_lseqDb_2eproto_once,
       file_level_metadata_lseqDb_2eproto[4]);
@@ -1634,77 +1916,68 @@ void PutRequest::InternalSwap(PutRequest* other) {
 
 // ===================================================================
 
-class SeekGetRequest::_Internal {
+class PutRequest::_Internal {
  public:
-  using HasBits = decltype(std::declval<SeekGetRequest>()._impl_._has_bits_);
-  static void set_has_key(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
-  static void set_has_limit(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
 };
 
-SeekGetRequest::SeekGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+PutRequest::PutRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:lseqdb.SeekGetRequest)
+  // @@protoc_insertion_point(arena_constructor:lseqdb.PutRequest)
 }
-SeekGetRequest::SeekGetRequest(const SeekGetRequest& from)
+PutRequest::PutRequest(const PutRequest& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  SeekGetRequest* const _this = this; (void)_this;
+  PutRequest* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){from._impl_._has_bits_}
-    , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.lseq_){}
-    , decltype(_impl_.key_){}
-    , decltype(_impl_.limit_){}};
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.durability_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.lseq_.InitDefault();
+  _impl_.key_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.lseq_.Set("", GetArenaForAllocation());
+    _impl_.key_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_lseq().empty()) {
-    _this->_impl_.lseq_.Set(from._internal_lseq(), 
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
       _this->GetArenaForAllocation());
   }
-  _impl_.key_.InitDefault();
+  _impl_.value_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.key_.Set("", GetArenaForAllocation());
+    _impl_.value_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_key()) {
-    _this->_impl_.key_.Set(from._internal_key(), 
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
       _this->GetArenaForAllocation());
   }
-  _this->_impl_.limit_ = from._impl_.limit_;
-  // @@protoc_insertion_point(copy_constructor:lseqdb.SeekGetRequest)
+  _this->_impl_.durability_ = from._impl_.durability_;
+  // @@protoc_insertion_point(copy_constructor:lseqdb.PutRequest)
 }
 
-inline void SeekGetRequest::SharedCtor(
+inline void PutRequest::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_._has_bits_){}
+      decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , decltype(_impl_.durability_){0}
     , /*decltype(_impl_._cached_size_)*/{}
-    , decltype(_impl_.lseq_){}
-    , decltype(_impl_.key_){}
-    , decltype(_impl_.limit_){0u}
   };
-  _impl_.lseq_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.lseq_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   _impl_.key_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
     _impl_.key_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-SeekGetRequest::~SeekGetRequest() {
-  // @@protoc_insertion_point(destructor:lseqdb.SeekGetRequest)
+PutRequest::~PutRequest() {
+  // @@protoc_insertion_point(destructor:lseqdb.PutRequest)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1712,65 +1985,60 @@ SeekGetRequest::~SeekGetRequest() {
   SharedDtor();
 }
 
-inline void SeekGetRequest::SharedDtor() {
+inline void PutRequest::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.lseq_.Destroy();
   _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
 }
 
-void SeekGetRequest::SetCachedSize(int size) const {
+void PutRequest::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void SeekGetRequest::Clear() {
-// @@protoc_insertion_point(message_clear_start:lseqdb.SeekGetRequest)
+void PutRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:lseqdb.PutRequest)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.lseq_.ClearToEmpty();
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    _impl_.key_.ClearNonDefaultToEmpty();
-  }
-  _impl_.limit_ = 0u;
-  _impl_._has_bits_.Clear();
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _impl_.durability_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* SeekGetRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* PutRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string lseq = 1;
+      // string key = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_lseq();
+          auto str = _internal_mutable_key();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.SeekGetRequest.lseq"));
+          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.PutRequest.key"));
         } else
           goto handle_unusual;
         continue;
-      // optional string key = 2;
+      // string value = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_key();
+          auto str = _internal_mutable_value();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.SeekGetRequest.key"));
+          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.PutRequest.value"));
         } else
           goto handle_unusual;
         continue;
-      // optional uint32 limit = 3;
+      // .lseqdb.Durability durability = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _Internal::set_has_limit(&has_bits);
-          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
+          _internal_set_durability(static_cast<::lseqdb::Durability>(val));
         } else
           goto handle_unusual;
         continue;
@@ -1790,7 +2058,6 @@ const char* SeekGetRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext
     CHK_(ptr != nullptr);
   }  // while
 message_done:
-  _impl_._has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -1798,219 +2065,1841 @@ failure:
 #undef CHK_
 }
 
-uint8_t* SeekGetRequest::_InternalSerialize(
+uint8_t* PutRequest::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.SeekGetRequest)
+  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.PutRequest)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string lseq = 1;
-  if (!this->_internal_lseq().empty()) {
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_lseq().data(), static_cast<int>(this->_internal_lseq().length()),
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "lseqdb.SeekGetRequest.lseq");
+      "lseqdb.PutRequest.key");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_lseq(), target);
+        1, this->_internal_key(), target);
   }
 
-  // optional string key = 2;
-  if (_internal_has_key()) {
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "lseqdb.SeekGetRequest.key");
+      "lseqdb.PutRequest.value");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_key(), target);
+        2, this->_internal_value(), target);
   }
 
-  // optional uint32 limit = 3;
-  if (_internal_has_limit()) {
+  // .lseqdb.Durability durability = 3;
+  if (this->_internal_durability() != 0) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_limit(), target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_durability(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.SeekGetRequest)
+  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.PutRequest)
   return target;
 }
 
-size_t SeekGetRequest::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:lseqdb.SeekGetRequest)
+size_t PutRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lseqdb.PutRequest)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string lseq = 1;
-  if (!this->_internal_lseq().empty()) {
+  // string key = 1;
+  if (!this->_internal_key().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_lseq());
+        this->_internal_key());
   }
 
-  cached_has_bits = _impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    // optional string key = 2;
-    if (cached_has_bits & 0x00000001u) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-          this->_internal_key());
-    }
-
-    // optional uint32 limit = 3;
-    if (cached_has_bits & 0x00000002u) {
-      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_limit());
-    }
+  // string value = 2;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
 
+  // .lseqdb.Durability durability = 3;
+  if (this->_internal_durability() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_durability());
   }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SeekGetRequest::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PutRequest::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    SeekGetRequest::MergeImpl
+    PutRequest::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SeekGetRequest::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PutRequest::GetClassData() const { return &_class_data_; }
 
 
-void SeekGetRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<SeekGetRequest*>(&to_msg);
-  auto& from = static_cast<const SeekGetRequest&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.SeekGetRequest)
+void PutRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PutRequest*>(&to_msg);
+  auto& from = static_cast<const PutRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.PutRequest)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_lseq().empty()) {
-    _this->_internal_set_lseq(from._internal_lseq());
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
   }
-  cached_has_bits = from._impl_._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _this->_internal_set_key(from._internal_key());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _this->_impl_.limit_ = from._impl_.limit_;
-    }
-    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  if (from._internal_durability() != 0) {
+    _this->_internal_set_durability(from._internal_durability());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void SeekGetRequest::CopyFrom(const SeekGetRequest& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.SeekGetRequest)
+void PutRequest::CopyFrom(const PutRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.PutRequest)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool SeekGetRequest::IsInitialized() const {
+bool PutRequest::IsInitialized() const {
   return true;
 }
 
-void SeekGetRequest::InternalSwap(SeekGetRequest* other) {
+void PutRequest::InternalSwap(PutRequest* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.lseq_, lhs_arena,
-      &other->_impl_.lseq_, rhs_arena
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
   );
+  swap(_impl_.durability_, other->_impl_.durability_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PutRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lseqDb_2eproto_getter, &descriptor_table_lseqDb_2eproto_once,
+      file_level_metadata_lseqDb_2eproto[5]);
+}
+
+// ===================================================================
+
+class SeekGetRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<SeekGetRequest>()._impl_._has_bits_);
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_limit(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_chunk_bytes(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+SeekGetRequest::SeekGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lseqdb.SeekGetRequest)
+}
+SeekGetRequest::SeekGetRequest(const SeekGetRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SeekGetRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lseq_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.limit_){}
+    , decltype(_impl_.chunk_bytes_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.lseq_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lseq_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_lseq().empty()) {
+    _this->_impl_.lseq_.Set(from._internal_lseq(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.limit_, &from._impl_.limit_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.chunk_bytes_) -
+    reinterpret_cast<char*>(&_impl_.limit_)) + sizeof(_impl_.chunk_bytes_));
+  // @@protoc_insertion_point(copy_constructor:lseqdb.SeekGetRequest)
+}
+
+inline void SeekGetRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.lseq_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.limit_){0u}
+    , decltype(_impl_.chunk_bytes_){0u}
+  };
+  _impl_.lseq_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lseq_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SeekGetRequest::~SeekGetRequest() {
+  // @@protoc_insertion_point(destructor:lseqdb.SeekGetRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SeekGetRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.lseq_.Destroy();
+  _impl_.key_.Destroy();
+}
+
+void SeekGetRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SeekGetRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:lseqdb.SeekGetRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.lseq_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.key_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.limit_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.chunk_bytes_) -
+        reinterpret_cast<char*>(&_impl_.limit_)) + sizeof(_impl_.chunk_bytes_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SeekGetRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes lseq = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_lseq();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.SeekGetRequest.key"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 limit = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_limit(&has_bits);
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 chunk_bytes = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_chunk_bytes(&has_bits);
+          _impl_.chunk_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SeekGetRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.SeekGetRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes lseq = 1;
+  if (!this->_internal_lseq().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_lseq(), target);
+  }
+
+  // optional string key = 2;
+  if (_internal_has_key()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "lseqdb.SeekGetRequest.key");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_key(), target);
+  }
+
+  // optional uint32 limit = 3;
+  if (_internal_has_limit()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(3, this->_internal_limit(), target);
+  }
+
+  // optional uint32 chunk_bytes = 4;
+  if (_internal_has_chunk_bytes()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_chunk_bytes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.SeekGetRequest)
+  return target;
+}
+
+size_t SeekGetRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lseqdb.SeekGetRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes lseq = 1;
+  if (!this->_internal_lseq().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_lseq());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string key = 2;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_key());
+    }
+
+    // optional uint32 limit = 3;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_limit());
+    }
+
+    // optional uint32 chunk_bytes = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_chunk_bytes());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SeekGetRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SeekGetRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SeekGetRequest::GetClassData() const { return &_class_data_; }
+
+
+void SeekGetRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SeekGetRequest*>(&to_msg);
+  auto& from = static_cast<const SeekGetRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.SeekGetRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_lseq().empty()) {
+    _this->_internal_set_lseq(from._internal_lseq());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_key(from._internal_key());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.limit_ = from._impl_.limit_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.chunk_bytes_ = from._impl_.chunk_bytes_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SeekGetRequest::CopyFrom(const SeekGetRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.SeekGetRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SeekGetRequest::IsInitialized() const {
+  return true;
+}
+
+void SeekGetRequest::InternalSwap(SeekGetRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.lseq_, lhs_arena,
+      &other->_impl_.lseq_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SeekGetRequest, _impl_.chunk_bytes_)
+      + sizeof(SeekGetRequest::_impl_.chunk_bytes_)
+      - PROTOBUF_FIELD_OFFSET(SeekGetRequest, _impl_.limit_)>(
+          reinterpret_cast<char*>(&_impl_.limit_),
+          reinterpret_cast<char*>(&other->_impl_.limit_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SeekGetRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lseqDb_2eproto_getter, &descriptor_table_lseqDb_2eproto_once,
+      file_level_metadata_lseqDb_2eproto[6]);
+}
+
+// ===================================================================
+
+class ScanRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<ScanRequest>()._impl_._has_bits_);
+  static void set_has_prefix(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_replica_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_limit(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+};
+
+ScanRequest::ScanRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lseqdb.ScanRequest)
+}
+ScanRequest::ScanRequest(const ScanRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ScanRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.start_){}
+    , decltype(_impl_.end_){}
+    , decltype(_impl_.prefix_){}
+    , decltype(_impl_.replica_id_){}
+    , decltype(_impl_.limit_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.start_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.start_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_start().empty()) {
+    _this->_impl_.start_.Set(from._internal_start(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.end_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.end_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_end().empty()) {
+    _this->_impl_.end_.Set(from._internal_end(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_prefix()) {
+    _this->_impl_.prefix_.Set(from._internal_prefix(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.replica_id_, &from._impl_.replica_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.limit_) -
+    reinterpret_cast<char*>(&_impl_.replica_id_)) + sizeof(_impl_.limit_));
+  // @@protoc_insertion_point(copy_constructor:lseqdb.ScanRequest)
+}
+
+inline void ScanRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.start_){}
+    , decltype(_impl_.end_){}
+    , decltype(_impl_.prefix_){}
+    , decltype(_impl_.replica_id_){0}
+    , decltype(_impl_.limit_){0u}
+  };
+  _impl_.start_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.start_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.end_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.end_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.prefix_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.prefix_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ScanRequest::~ScanRequest() {
+  // @@protoc_insertion_point(destructor:lseqdb.ScanRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ScanRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.start_.Destroy();
+  _impl_.end_.Destroy();
+  _impl_.prefix_.Destroy();
+}
+
+void ScanRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ScanRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:lseqdb.ScanRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.start_.ClearToEmpty();
+  _impl_.end_.ClearToEmpty();
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    _impl_.prefix_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x00000006u) {
+    ::memset(&_impl_.replica_id_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&_impl_.limit_) -
+        reinterpret_cast<char*>(&_impl_.replica_id_)) + sizeof(_impl_.limit_));
+  }
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ScanRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string start = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_start();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.ScanRequest.start"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string end = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_end();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.ScanRequest.end"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string prefix = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_prefix();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.ScanRequest.prefix"));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 replica_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_replica_id(&has_bits);
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 limit = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_limit(&has_bits);
+          _impl_.limit_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ScanRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.ScanRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string start = 1;
+  if (!this->_internal_start().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_start().data(), static_cast<int>(this->_internal_start().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "lseqdb.ScanRequest.start");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_start(), target);
+  }
+
+  // string end = 2;
+  if (!this->_internal_end().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_end().data(), static_cast<int>(this->_internal_end().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "lseqdb.ScanRequest.end");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_end(), target);
+  }
+
+  // optional string prefix = 3;
+  if (_internal_has_prefix()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_prefix().data(), static_cast<int>(this->_internal_prefix().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "lseqdb.ScanRequest.prefix");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_prefix(), target);
+  }
+
+  // optional int32 replica_id = 4;
+  if (_internal_has_replica_id()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(4, this->_internal_replica_id(), target);
+  }
+
+  // optional uint32 limit = 5;
+  if (_internal_has_limit()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_limit(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.ScanRequest)
+  return target;
+}
+
+size_t ScanRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lseqdb.ScanRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string start = 1;
+  if (!this->_internal_start().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_start());
+  }
+
+  // string end = 2;
+  if (!this->_internal_end().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_end());
+  }
+
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    // optional string prefix = 3;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_prefix());
+    }
+
+    // optional int32 replica_id = 4;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+    }
+
+    // optional uint32 limit = 5;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_limit());
+    }
+
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ScanRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ScanRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ScanRequest::GetClassData() const { return &_class_data_; }
+
+
+void ScanRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ScanRequest*>(&to_msg);
+  auto& from = static_cast<const ScanRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.ScanRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_start().empty()) {
+    _this->_internal_set_start(from._internal_start());
+  }
+  if (!from._internal_end().empty()) {
+    _this->_internal_set_end(from._internal_end());
+  }
+  cached_has_bits = from._impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _this->_internal_set_prefix(from._internal_prefix());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _this->_impl_.replica_id_ = from._impl_.replica_id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _this->_impl_.limit_ = from._impl_.limit_;
+    }
+    _this->_impl_._has_bits_[0] |= cached_has_bits;
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ScanRequest::CopyFrom(const ScanRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.ScanRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ScanRequest::IsInitialized() const {
+  return true;
+}
+
+void ScanRequest::InternalSwap(ScanRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.start_, lhs_arena,
+      &other->_impl_.start_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.end_, lhs_arena,
+      &other->_impl_.end_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.prefix_, lhs_arena,
+      &other->_impl_.prefix_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ScanRequest, _impl_.limit_)
+      + sizeof(ScanRequest::_impl_.limit_)
+      - PROTOBUF_FIELD_OFFSET(ScanRequest, _impl_.replica_id_)>(
+          reinterpret_cast<char*>(&_impl_.replica_id_),
+          reinterpret_cast<char*>(&other->_impl_.replica_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ScanRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lseqDb_2eproto_getter, &descriptor_table_lseqDb_2eproto_once,
+      file_level_metadata_lseqDb_2eproto[7]);
+}
+
+// ===================================================================
+
+class MultiGetRequest::_Internal {
+ public:
+  using HasBits = decltype(std::declval<MultiGetRequest>()._impl_._has_bits_);
+  static void set_has_replica_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+};
+
+MultiGetRequest::MultiGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lseqdb.MultiGetRequest)
+}
+MultiGetRequest::MultiGetRequest(const MultiGetRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  MultiGetRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){from._impl_._has_bits_}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){from._impl_.keys_}
+    , decltype(_impl_.replica_id_){}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.replica_id_ = from._impl_.replica_id_;
+  // @@protoc_insertion_point(copy_constructor:lseqdb.MultiGetRequest)
+}
+
+inline void MultiGetRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_._has_bits_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , decltype(_impl_.keys_){arena}
+    , decltype(_impl_.replica_id_){0}
+  };
+}
+
+MultiGetRequest::~MultiGetRequest() {
+  // @@protoc_insertion_point(destructor:lseqdb.MultiGetRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void MultiGetRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.keys_.~RepeatedPtrField();
+}
+
+void MultiGetRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void MultiGetRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:lseqdb.MultiGetRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.keys_.Clear();
+  _impl_.replica_id_ = 0;
+  _impl_._has_bits_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* MultiGetRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated string keys = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_keys();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "lseqdb.MultiGetRequest.keys"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional int32 replica_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_replica_id(&has_bits);
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _impl_._has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* MultiGetRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.MultiGetRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string keys = 1;
+  for (int i = 0, n = this->_internal_keys_size(); i < n; i++) {
+    const auto& s = this->_internal_keys(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "lseqdb.MultiGetRequest.keys");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // optional int32 replica_id = 2;
+  if (_internal_has_replica_id()) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_replica_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.MultiGetRequest)
+  return target;
+}
+
+size_t MultiGetRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lseqdb.MultiGetRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string keys = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(_impl_.keys_.size());
+  for (int i = 0, n = _impl_.keys_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      _impl_.keys_.Get(i));
+  }
+
+  // optional int32 replica_id = 2;
+  cached_has_bits = _impl_._has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData MultiGetRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    MultiGetRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*MultiGetRequest::GetClassData() const { return &_class_data_; }
+
+
+void MultiGetRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<MultiGetRequest*>(&to_msg);
+  auto& from = static_cast<const MultiGetRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.MultiGetRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.keys_.MergeFrom(from._impl_.keys_);
+  if (from._internal_has_replica_id()) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void MultiGetRequest::CopyFrom(const MultiGetRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.MultiGetRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool MultiGetRequest::IsInitialized() const {
+  return true;
+}
+
+void MultiGetRequest::InternalSwap(MultiGetRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_._has_bits_[0], other->_impl_._has_bits_[0]);
+  _impl_.keys_.InternalSwap(&other->_impl_.keys_);
+  swap(_impl_.replica_id_, other->_impl_.replica_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata MultiGetRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lseqDb_2eproto_getter, &descriptor_table_lseqDb_2eproto_once,
+      file_level_metadata_lseqDb_2eproto[8]);
+}
+
+// ===================================================================
+
+class DBItems_DbItem::_Internal {
+ public:
+};
+
+DBItems_DbItem::DBItems_DbItem(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lseqdb.DBItems.DbItem)
+}
+DBItems_DbItem::DBItems_DbItem(const DBItems_DbItem& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DBItems_DbItem* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lseq_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.lseq_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lseq_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_lseq().empty()) {
+    _this->_impl_.lseq_.Set(from._internal_lseq(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_key().empty()) {
+    _this->_impl_.key_.Set(from._internal_key(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_value().empty()) {
+    _this->_impl_.value_.Set(from._internal_value(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:lseqdb.DBItems.DbItem)
+}
+
+inline void DBItems_DbItem::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lseq_){}
+    , decltype(_impl_.key_){}
+    , decltype(_impl_.value_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.lseq_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.lseq_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.value_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.value_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+DBItems_DbItem::~DBItems_DbItem() {
+  // @@protoc_insertion_point(destructor:lseqdb.DBItems.DbItem)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DBItems_DbItem::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.lseq_.Destroy();
+  _impl_.key_.Destroy();
+  _impl_.value_.Destroy();
+}
+
+void DBItems_DbItem::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DBItems_DbItem::Clear() {
+// @@protoc_insertion_point(message_clear_start:lseqdb.DBItems.DbItem)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.lseq_.ClearToEmpty();
+  _impl_.key_.ClearToEmpty();
+  _impl_.value_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DBItems_DbItem::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes lseq = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_lseq();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string value = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_value();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.DBItems.DbItem.value"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DBItems_DbItem::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.DBItems.DbItem)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes lseq = 1;
+  if (!this->_internal_lseq().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_lseq(), target);
+  }
+
+  // bytes key = 2;
+  if (!this->_internal_key().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_key(), target);
+  }
+
+  // string value = 3;
+  if (!this->_internal_value().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "lseqdb.DBItems.DbItem.value");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_value(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.DBItems.DbItem)
+  return target;
+}
+
+size_t DBItems_DbItem::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lseqdb.DBItems.DbItem)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes lseq = 1;
+  if (!this->_internal_lseq().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_lseq());
+  }
+
+  // bytes key = 2;
+  if (!this->_internal_key().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
+  }
+
+  // string value = 3;
+  if (!this->_internal_value().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_value());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DBItems_DbItem::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DBItems_DbItem::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DBItems_DbItem::GetClassData() const { return &_class_data_; }
+
+
+void DBItems_DbItem::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DBItems_DbItem*>(&to_msg);
+  auto& from = static_cast<const DBItems_DbItem&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.DBItems.DbItem)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_lseq().empty()) {
+    _this->_internal_set_lseq(from._internal_lseq());
+  }
+  if (!from._internal_key().empty()) {
+    _this->_internal_set_key(from._internal_key());
+  }
+  if (!from._internal_value().empty()) {
+    _this->_internal_set_value(from._internal_value());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DBItems_DbItem::CopyFrom(const DBItems_DbItem& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.DBItems.DbItem)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DBItems_DbItem::IsInitialized() const {
+  return true;
+}
+
+void DBItems_DbItem::InternalSwap(DBItems_DbItem* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.lseq_, lhs_arena,
+      &other->_impl_.lseq_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.key_, lhs_arena,
+      &other->_impl_.key_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.value_, lhs_arena,
+      &other->_impl_.value_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DBItems_DbItem::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lseqDb_2eproto_getter, &descriptor_table_lseqDb_2eproto_once,
+      file_level_metadata_lseqDb_2eproto[9]);
+}
+
+// ===================================================================
+
+class DBItems::_Internal {
+ public:
+};
+
+DBItems::DBItems(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lseqdb.DBItems)
+}
+DBItems::DBItems(const DBItems& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DBItems* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.items_){from._impl_.items_}
+    , decltype(_impl_.replica_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.replica_id_ = from._impl_.replica_id_;
+  // @@protoc_insertion_point(copy_constructor:lseqdb.DBItems)
+}
+
+inline void DBItems::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.items_){arena}
+    , decltype(_impl_.replica_id_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+DBItems::~DBItems() {
+  // @@protoc_insertion_point(destructor:lseqdb.DBItems)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DBItems::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.items_.~RepeatedPtrField();
+}
+
+void DBItems::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DBItems::Clear() {
+// @@protoc_insertion_point(message_clear_start:lseqdb.DBItems)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.items_.Clear();
+  _impl_.replica_id_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DBItems::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .lseqdb.DBItems.DbItem items = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_items(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 replica_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DBItems::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.DBItems)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .lseqdb.DBItems.DbItem items = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_items_size()); i < n; i++) {
+    const auto& repfield = this->_internal_items(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // int32 replica_id = 2;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_replica_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.DBItems)
+  return target;
+}
+
+size_t DBItems::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lseqdb.DBItems)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .lseqdb.DBItems.DbItem items = 1;
+  total_size += 1UL * this->_internal_items_size();
+  for (const auto& msg : this->_impl_.items_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // int32 replica_id = 2;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DBItems::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DBItems::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DBItems::GetClassData() const { return &_class_data_; }
+
+
+void DBItems::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DBItems*>(&to_msg);
+  auto& from = static_cast<const DBItems&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.DBItems)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.items_.MergeFrom(from._impl_.items_);
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DBItems::CopyFrom(const DBItems& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.DBItems)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DBItems::IsInitialized() const {
+  return true;
+}
+
+void DBItems::InternalSwap(DBItems* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.items_.InternalSwap(&other->_impl_.items_);
+  swap(_impl_.replica_id_, other->_impl_.replica_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DBItems::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_lseqDb_2eproto_getter, &descriptor_table_lseqDb_2eproto_once,
+      file_level_metadata_lseqDb_2eproto[10]);
+}
+
+// ===================================================================
+
+class SyncAck::_Internal {
+ public:
+};
+
+SyncAck::SyncAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:lseqdb.SyncAck)
+}
+SyncAck::SyncAck(const SyncAck& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SyncAck* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.applied_lseq_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.applied_lseq_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.applied_lseq_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_applied_lseq().empty()) {
+    _this->_impl_.applied_lseq_.Set(from._internal_applied_lseq(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:lseqdb.SyncAck)
+}
+
+inline void SyncAck::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.applied_lseq_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.applied_lseq_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.applied_lseq_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SyncAck::~SyncAck() {
+  // @@protoc_insertion_point(destructor:lseqdb.SyncAck)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SyncAck::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.applied_lseq_.Destroy();
+}
+
+void SyncAck::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SyncAck::Clear() {
+// @@protoc_insertion_point(message_clear_start:lseqdb.SyncAck)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.applied_lseq_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SyncAck::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes applied_lseq = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_applied_lseq();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SyncAck::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.SyncAck)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes applied_lseq = 1;
+  if (!this->_internal_applied_lseq().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_applied_lseq(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.SyncAck)
+  return target;
+}
+
+size_t SyncAck::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lseqdb.SyncAck)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes applied_lseq = 1;
+  if (!this->_internal_applied_lseq().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_applied_lseq());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SyncAck::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SyncAck::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SyncAck::GetClassData() const { return &_class_data_; }
+
+
+void SyncAck::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SyncAck*>(&to_msg);
+  auto& from = static_cast<const SyncAck&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.SyncAck)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_applied_lseq().empty()) {
+    _this->_internal_set_applied_lseq(from._internal_applied_lseq());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SyncAck::CopyFrom(const SyncAck& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.SyncAck)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SyncAck::IsInitialized() const {
+  return true;
+}
+
+void SyncAck::InternalSwap(SyncAck* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.key_, lhs_arena,
-      &other->_impl_.key_, rhs_arena
+      &_impl_.applied_lseq_, lhs_arena,
+      &other->_impl_.applied_lseq_, rhs_arena
   );
-  swap(_impl_.limit_, other->_impl_.limit_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata SeekGetRequest::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SyncAck::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_lseqDb_2eproto_getter, &descriptor_table_lseqDb_2eproto_once,
-      file_level_metadata_lseqDb_2eproto[5]);
+      file_level_metadata_lseqDb_2eproto[11]);
 }
 
 // ===================================================================
 
-class DBItems_DbItem::_Internal {
+class SeqVector_Entry::_Internal {
  public:
 };
 
-DBItems_DbItem::DBItems_DbItem(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SeqVector_Entry::SeqVector_Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:lseqdb.DBItems.DbItem)
+  // @@protoc_insertion_point(arena_constructor:lseqdb.SeqVector.Entry)
 }
-DBItems_DbItem::DBItems_DbItem(const DBItems_DbItem& from)
+SeqVector_Entry::SeqVector_Entry(const SeqVector_Entry& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  DBItems_DbItem* const _this = this; (void)_this;
+  SeqVector_Entry* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.lseq_){}
-    , decltype(_impl_.key_){}
-    , decltype(_impl_.value_){}
+      decltype(_impl_.seq_){}
+    , decltype(_impl_.replica_id_){}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _impl_.lseq_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.lseq_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_lseq().empty()) {
-    _this->_impl_.lseq_.Set(from._internal_lseq(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.key_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.key_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_key().empty()) {
-    _this->_impl_.key_.Set(from._internal_key(), 
-      _this->GetArenaForAllocation());
-  }
-  _impl_.value_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.value_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_value().empty()) {
-    _this->_impl_.value_.Set(from._internal_value(), 
-      _this->GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:lseqdb.DBItems.DbItem)
+  ::memcpy(&_impl_.seq_, &from._impl_.seq_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.replica_id_) -
+    reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.replica_id_));
+  // @@protoc_insertion_point(copy_constructor:lseqdb.SeqVector.Entry)
 }
 
-inline void DBItems_DbItem::SharedCtor(
+inline void SeqVector_Entry::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.lseq_){}
-    , decltype(_impl_.key_){}
-    , decltype(_impl_.value_){}
+      decltype(_impl_.seq_){uint64_t{0u}}
+    , decltype(_impl_.replica_id_){0}
     , /*decltype(_impl_._cached_size_)*/{}
   };
-  _impl_.lseq_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.lseq_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.key_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.key_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  _impl_.value_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    _impl_.value_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-DBItems_DbItem::~DBItems_DbItem() {
-  // @@protoc_insertion_point(destructor:lseqdb.DBItems.DbItem)
+SeqVector_Entry::~SeqVector_Entry() {
+  // @@protoc_insertion_point(destructor:lseqdb.SeqVector.Entry)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2018,62 +3907,45 @@ DBItems_DbItem::~DBItems_DbItem() {
   SharedDtor();
 }
 
-inline void DBItems_DbItem::SharedDtor() {
+inline void SeqVector_Entry::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.lseq_.Destroy();
-  _impl_.key_.Destroy();
-  _impl_.value_.Destroy();
 }
 
-void DBItems_DbItem::SetCachedSize(int size) const {
+void SeqVector_Entry::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void DBItems_DbItem::Clear() {
-// @@protoc_insertion_point(message_clear_start:lseqdb.DBItems.DbItem)
+void SeqVector_Entry::Clear() {
+// @@protoc_insertion_point(message_clear_start:lseqdb.SeqVector.Entry)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.lseq_.ClearToEmpty();
-  _impl_.key_.ClearToEmpty();
-  _impl_.value_.ClearToEmpty();
+  ::memset(&_impl_.seq_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.replica_id_) -
+      reinterpret_cast<char*>(&_impl_.seq_)) + sizeof(_impl_.replica_id_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* DBItems_DbItem::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SeqVector_Entry::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string lseq = 1;
+      // int32 replica_id = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_lseq();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.DBItems.DbItem.lseq"));
         } else
           goto handle_unusual;
         continue;
-      // string key = 2;
+      // uint64 seq = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_key();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.DBItems.DbItem.key"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string value = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_value();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.seq_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "lseqdb.DBItems.DbItem.value"));
         } else
           goto handle_unusual;
         continue;
@@ -2100,183 +3972,140 @@ failure:
 #undef CHK_
 }
 
-uint8_t* DBItems_DbItem::_InternalSerialize(
+uint8_t* SeqVector_Entry::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.DBItems.DbItem)
+  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.SeqVector.Entry)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string lseq = 1;
-  if (!this->_internal_lseq().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_lseq().data(), static_cast<int>(this->_internal_lseq().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "lseqdb.DBItems.DbItem.lseq");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_lseq(), target);
-  }
-
-  // string key = 2;
-  if (!this->_internal_key().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_key().data(), static_cast<int>(this->_internal_key().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "lseqdb.DBItems.DbItem.key");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_key(), target);
+  // int32 replica_id = 1;
+  if (this->_internal_replica_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_replica_id(), target);
   }
 
-  // string value = 3;
-  if (!this->_internal_value().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_value().data(), static_cast<int>(this->_internal_value().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "lseqdb.DBItems.DbItem.value");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_value(), target);
+  // uint64 seq = 2;
+  if (this->_internal_seq() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_seq(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.DBItems.DbItem)
+  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.SeqVector.Entry)
   return target;
 }
 
-size_t DBItems_DbItem::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:lseqdb.DBItems.DbItem)
+size_t SeqVector_Entry::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lseqdb.SeqVector.Entry)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string lseq = 1;
-  if (!this->_internal_lseq().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_lseq());
-  }
-
-  // string key = 2;
-  if (!this->_internal_key().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_key());
+  // uint64 seq = 2;
+  if (this->_internal_seq() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seq());
   }
 
-  // string value = 3;
-  if (!this->_internal_value().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_value());
+  // int32 replica_id = 1;
+  if (this->_internal_replica_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DBItems_DbItem::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SeqVector_Entry::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    DBItems_DbItem::MergeImpl
+    SeqVector_Entry::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DBItems_DbItem::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SeqVector_Entry::GetClassData() const { return &_class_data_; }
 
 
-void DBItems_DbItem::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<DBItems_DbItem*>(&to_msg);
-  auto& from = static_cast<const DBItems_DbItem&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.DBItems.DbItem)
+void SeqVector_Entry::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SeqVector_Entry*>(&to_msg);
+  auto& from = static_cast<const SeqVector_Entry&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.SeqVector.Entry)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_lseq().empty()) {
-    _this->_internal_set_lseq(from._internal_lseq());
-  }
-  if (!from._internal_key().empty()) {
-    _this->_internal_set_key(from._internal_key());
+  if (from._internal_seq() != 0) {
+    _this->_internal_set_seq(from._internal_seq());
   }
-  if (!from._internal_value().empty()) {
-    _this->_internal_set_value(from._internal_value());
+  if (from._internal_replica_id() != 0) {
+    _this->_internal_set_replica_id(from._internal_replica_id());
   }
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void DBItems_DbItem::CopyFrom(const DBItems_DbItem& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.DBItems.DbItem)
+void SeqVector_Entry::CopyFrom(const SeqVector_Entry& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.SeqVector.Entry)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool DBItems_DbItem::IsInitialized() const {
+bool SeqVector_Entry::IsInitialized() const {
   return true;
 }
 
-void DBItems_DbItem::InternalSwap(DBItems_DbItem* other) {
+void SeqVector_Entry::InternalSwap(SeqVector_Entry* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.lseq_, lhs_arena,
-      &other->_impl_.lseq_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.key_, lhs_arena,
-      &other->_impl_.key_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &_impl_.value_, lhs_arena,
-      &other->_impl_.value_, rhs_arena
-  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SeqVector_Entry, _impl_.replica_id_)
+      + sizeof(SeqVector_Entry::_impl_.replica_id_)
+      - PROTOBUF_FIELD_OFFSET(SeqVector_Entry, _impl_.seq_)>(
+          reinterpret_cast<char*>(&_impl_.seq_),
+          reinterpret_cast<char*>(&other->_impl_.seq_));
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata DBItems_DbItem::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SeqVector_Entry::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_lseqDb_2eproto_getter, &descriptor_table_lseqDb_2eproto_once,
-      file_level_metadata_lseqDb_2eproto[6]);
+      file_level_metadata_lseqDb_2eproto[12]);
 }
 
 // ===================================================================
 
-class DBItems::_Internal {
+class SeqVector::_Internal {
  public:
 };
 
-DBItems::DBItems(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+SeqVector::SeqVector(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor(arena, is_message_owned);
-  // @@protoc_insertion_point(arena_constructor:lseqdb.DBItems)
+  // @@protoc_insertion_point(arena_constructor:lseqdb.SeqVector)
 }
-DBItems::DBItems(const DBItems& from)
+SeqVector::SeqVector(const SeqVector& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
-  DBItems* const _this = this; (void)_this;
+  SeqVector* const _this = this; (void)_this;
   new (&_impl_) Impl_{
-      decltype(_impl_.items_){from._impl_.items_}
-    , decltype(_impl_.replica_id_){}
+      decltype(_impl_.entries_){from._impl_.entries_}
     , /*decltype(_impl_._cached_size_)*/{}};
 
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  _this->_impl_.replica_id_ = from._impl_.replica_id_;
-  // @@protoc_insertion_point(copy_constructor:lseqdb.DBItems)
+  // @@protoc_insertion_point(copy_constructor:lseqdb.SeqVector)
 }
 
-inline void DBItems::SharedCtor(
+inline void SeqVector::SharedCtor(
     ::_pb::Arena* arena, bool is_message_owned) {
   (void)arena;
   (void)is_message_owned;
   new (&_impl_) Impl_{
-      decltype(_impl_.items_){arena}
-    , decltype(_impl_.replica_id_){0}
+      decltype(_impl_.entries_){arena}
     , /*decltype(_impl_._cached_size_)*/{}
   };
 }
 
-DBItems::~DBItems() {
-  // @@protoc_insertion_point(destructor:lseqdb.DBItems)
+SeqVector::~SeqVector() {
+  // @@protoc_insertion_point(destructor:lseqdb.SeqVector)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2284,53 +4113,44 @@ DBItems::~DBItems() {
   SharedDtor();
 }
 
-inline void DBItems::SharedDtor() {
+inline void SeqVector::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  _impl_.items_.~RepeatedPtrField();
+  _impl_.entries_.~RepeatedPtrField();
 }
 
-void DBItems::SetCachedSize(int size) const {
+void SeqVector::SetCachedSize(int size) const {
   _impl_._cached_size_.Set(size);
 }
 
-void DBItems::Clear() {
-// @@protoc_insertion_point(message_clear_start:lseqdb.DBItems)
+void SeqVector::Clear() {
+// @@protoc_insertion_point(message_clear_start:lseqdb.SeqVector)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  _impl_.items_.Clear();
-  _impl_.replica_id_ = 0;
+  _impl_.entries_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* DBItems::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* SeqVector::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .lseqdb.DBItems.DbItem items = 1;
+      // repeated .lseqdb.SeqVector.Entry entries = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
           ptr -= 1;
           do {
             ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_items(), ptr);
+            ptr = ctx->ParseMessage(_internal_add_entries(), ptr);
             CHK_(ptr);
             if (!ctx->DataAvailable(ptr)) break;
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // int32 replica_id = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _impl_.replica_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2354,101 +4174,86 @@ failure:
 #undef CHK_
 }
 
-uint8_t* DBItems::_InternalSerialize(
+uint8_t* SeqVector::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.DBItems)
+  // @@protoc_insertion_point(serialize_to_array_start:lseqdb.SeqVector)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .lseqdb.DBItems.DbItem items = 1;
+  // repeated .lseqdb.SeqVector.Entry entries = 1;
   for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_items_size()); i < n; i++) {
-    const auto& repfield = this->_internal_items(i);
+      n = static_cast<unsigned>(this->_internal_entries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_entries(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
         InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // int32 replica_id = 2;
-  if (this->_internal_replica_id() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_replica_id(), target);
-  }
-
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.DBItems)
+  // @@protoc_insertion_point(serialize_to_array_end:lseqdb.SeqVector)
   return target;
 }
 
-size_t DBItems::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:lseqdb.DBItems)
+size_t SeqVector::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:lseqdb.SeqVector)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .lseqdb.DBItems.DbItem items = 1;
-  total_size += 1UL * this->_internal_items_size();
-  for (const auto& msg : this->_impl_.items_) {
+  // repeated .lseqdb.SeqVector.Entry entries = 1;
+  total_size += 1UL * this->_internal_entries_size();
+  for (const auto& msg : this->_impl_.entries_) {
     total_size +=
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // int32 replica_id = 2;
-  if (this->_internal_replica_id() != 0) {
-    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_replica_id());
-  }
-
   return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DBItems::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SeqVector::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
-    DBItems::MergeImpl
+    SeqVector::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DBItems::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SeqVector::GetClassData() const { return &_class_data_; }
 
 
-void DBItems::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
-  auto* const _this = static_cast<DBItems*>(&to_msg);
-  auto& from = static_cast<const DBItems&>(from_msg);
-  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.DBItems)
+void SeqVector::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SeqVector*>(&to_msg);
+  auto& from = static_cast<const SeqVector&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:lseqdb.SeqVector)
   GOOGLE_DCHECK_NE(&from, _this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  _this->_impl_.items_.MergeFrom(from._impl_.items_);
-  if (from._internal_replica_id() != 0) {
-    _this->_internal_set_replica_id(from._internal_replica_id());
-  }
+  _this->_impl_.entries_.MergeFrom(from._impl_.entries_);
   _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void DBItems::CopyFrom(const DBItems& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.DBItems)
+void SeqVector::CopyFrom(const SeqVector& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:lseqdb.SeqVector)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool DBItems::IsInitialized() const {
+bool SeqVector::IsInitialized() const {
   return true;
 }
 
-void DBItems::InternalSwap(DBItems* other) {
+void SeqVector::InternalSwap(SeqVector* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  _impl_.items_.InternalSwap(&other->_impl_.items_);
-  swap(_impl_.replica_id_, other->_impl_.replica_id_);
+  _impl_.entries_.InternalSwap(&other->_impl_.entries_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata DBItems::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata SeqVector::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_lseqDb_2eproto_getter, &descriptor_table_lseqDb_2eproto_once,
-      file_level_metadata_lseqDb_2eproto[7]);
+      file_level_metadata_lseqDb_2eproto[13]);
 }
 
 // ===================================================================
@@ -2659,7 +4464,7 @@ void Config::InternalSwap(Config* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata Config::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_lseqDb_2eproto_getter, &descriptor_table_lseqDb_2eproto_once,
-      file_level_metadata_lseqDb_2eproto[8]);
+      file_level_metadata_lseqDb_2eproto[14]);
 }
 
 // ===================================================================
@@ -2837,7 +4642,7 @@ void SyncGetRequest::InternalSwap(SyncGetRequest* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata SyncGetRequest::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_lseqDb_2eproto_getter, &descriptor_table_lseqDb_2eproto_once,
-      file_level_metadata_lseqDb_2eproto[9]);
+      file_level_metadata_lseqDb_2eproto[15]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -2859,6 +4664,10 @@ template<> PROTOBUF_NOINLINE ::lseqdb::EventsRequest*
 Arena::CreateMaybeMessage< ::lseqdb::EventsRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::lseqdb::EventsRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::lseqdb::WatchRequest*
+Arena::CreateMaybeMessage< ::lseqdb::WatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lseqdb::WatchRequest >(arena);
+}
 template<> PROTOBUF_NOINLINE ::lseqdb::PutRequest*
 Arena::CreateMaybeMessage< ::lseqdb::PutRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::lseqdb::PutRequest >(arena);
@@ -2867,6 +4676,14 @@ template<> PROTOBUF_NOINLINE ::lseqdb::SeekGetRequest*
 Arena::CreateMaybeMessage< ::lseqdb::SeekGetRequest >(Arena* arena) {
   return Arena::CreateMessageInternal< ::lseqdb::SeekGetRequest >(arena);
 }
+template<> PROTOBUF_NOINLINE ::lseqdb::ScanRequest*
+Arena::CreateMaybeMessage< ::lseqdb::ScanRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lseqdb::ScanRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lseqdb::MultiGetRequest*
+Arena::CreateMaybeMessage< ::lseqdb::MultiGetRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lseqdb::MultiGetRequest >(arena);
+}
 template<> PROTOBUF_NOINLINE ::lseqdb::DBItems_DbItem*
 Arena::CreateMaybeMessage< ::lseqdb::DBItems_DbItem >(Arena* arena) {
   return Arena::CreateMessageInternal< ::lseqdb::DBItems_DbItem >(arena);
@@ -2875,6 +4692,18 @@ template<> PROTOBUF_NOINLINE ::lseqdb::DBItems*
 Arena::CreateMaybeMessage< ::lseqdb::DBItems >(Arena* arena) {
   return Arena::CreateMessageInternal< ::lseqdb::DBItems >(arena);
 }
+template<> PROTOBUF_NOINLINE ::lseqdb::SyncAck*
+Arena::CreateMaybeMessage< ::lseqdb::SyncAck >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lseqdb::SyncAck >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lseqdb::SeqVector_Entry*
+Arena::CreateMaybeMessage< ::lseqdb::SeqVector_Entry >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lseqdb::SeqVector_Entry >(arena);
+}
+template<> PROTOBUF_NOINLINE ::lseqdb::SeqVector*
+Arena::CreateMaybeMessage< ::lseqdb::SeqVector >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::lseqdb::SeqVector >(arena);
+}
 template<> PROTOBUF_NOINLINE ::lseqdb::Config*
 Arena::CreateMaybeMessage< ::lseqdb::Config >(Arena* arena) {
   return Arena::CreateMessageInternal< ::lseqdb::Config >(arena);
@@ -29,6 +29,7 @@
 #include <google/protobuf/message.h>
 #include <google/protobuf/repeated_field.h>  // IWYU pragma: export
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
 #include <google/protobuf/unknown_field_set.h>
 #include <google/protobuf/empty.pb.h>
 // @@protoc_insertion_point(includes)
@@ -61,21 +62,39 @@ extern EventsRequestDefaultTypeInternal _EventsRequest_default_instance_;
 class LSeq;
 struct LSeqDefaultTypeInternal;
 extern LSeqDefaultTypeInternal _LSeq_default_instance_;
+class MultiGetRequest;
+struct MultiGetRequestDefaultTypeInternal;
+extern MultiGetRequestDefaultTypeInternal _MultiGetRequest_default_instance_;
 class PutRequest;
 struct PutRequestDefaultTypeInternal;
 extern PutRequestDefaultTypeInternal _PutRequest_default_instance_;
 class ReplicaKey;
 struct ReplicaKeyDefaultTypeInternal;
 extern ReplicaKeyDefaultTypeInternal _ReplicaKey_default_instance_;
+class ScanRequest;
+struct ScanRequestDefaultTypeInternal;
+extern ScanRequestDefaultTypeInternal _ScanRequest_default_instance_;
 class SeekGetRequest;
 struct SeekGetRequestDefaultTypeInternal;
 extern SeekGetRequestDefaultTypeInternal _SeekGetRequest_default_instance_;
+class SeqVector;
+struct SeqVectorDefaultTypeInternal;
+extern SeqVectorDefaultTypeInternal _SeqVector_default_instance_;
+class SeqVector_Entry;
+struct SeqVector_EntryDefaultTypeInternal;
+extern SeqVector_EntryDefaultTypeInternal _SeqVector_Entry_default_instance_;
+class SyncAck;
+struct SyncAckDefaultTypeInternal;
+extern SyncAckDefaultTypeInternal _SyncAck_default_instance_;
 class SyncGetRequest;
 struct SyncGetRequestDefaultTypeInternal;
 extern SyncGetRequestDefaultTypeInternal _SyncGetRequest_default_instance_;
 class Value;
 struct ValueDefaultTypeInternal;
 extern ValueDefaultTypeInternal _Value_default_instance_;
+class WatchRequest;
+struct WatchRequestDefaultTypeInternal;
+extern WatchRequestDefaultTypeInternal _WatchRequest_default_instance_;
 }  // namespace lseqdb
 PROTOBUF_NAMESPACE_OPEN
 template<> ::lseqdb::Config* Arena::CreateMaybeMessage<::lseqdb::Config>(Arena*);
@@ -83,14 +102,47 @@ template<> ::lseqdb::DBItems* Arena::CreateMaybeMessage<::lseqdb::DBItems>(Arena
 template<> ::lseqdb::DBItems_DbItem* Arena::CreateMaybeMessage<::lseqdb::DBItems_DbItem>(Arena*);
 template<> ::lseqdb::EventsRequest* Arena::CreateMaybeMessage<::lseqdb::EventsRequest>(Arena*);
 template<> ::lseqdb::LSeq* Arena::CreateMaybeMessage<::lseqdb::LSeq>(Arena*);
+template<> ::lseqdb::MultiGetRequest* Arena::CreateMaybeMessage<::lseqdb::MultiGetRequest>(Arena*);
 template<> ::lseqdb::PutRequest* Arena::CreateMaybeMessage<::lseqdb::PutRequest>(Arena*);
 template<> ::lseqdb::ReplicaKey* Arena::CreateMaybeMessage<::lseqdb::ReplicaKey>(Arena*);
+template<> ::lseqdb::ScanRequest* Arena::CreateMaybeMessage<::lseqdb::ScanRequest>(Arena*);
 template<> ::lseqdb::SeekGetRequest* Arena::CreateMaybeMessage<::lseqdb::SeekGetRequest>(Arena*);
+template<> ::lseqdb::SeqVector* Arena::CreateMaybeMessage<::lseqdb::SeqVector>(Arena*);
+template<> ::lseqdb::SeqVector_Entry* Arena::CreateMaybeMessage<::lseqdb::SeqVector_Entry>(Arena*);
+template<> ::lseqdb::SyncAck* Arena::CreateMaybeMessage<::lseqdb::SyncAck>(Arena*);
 template<> ::lseqdb::SyncGetRequest* Arena::CreateMaybeMessage<::lseqdb::SyncGetRequest>(Arena*);
 template<> ::lseqdb::Value* Arena::CreateMaybeMessage<::lseqdb::Value>(Arena*);
+template<> ::lseqdb::WatchRequest* Arena::CreateMaybeMessage<::lseqdb::WatchRequest>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace lseqdb {
 
+enum Durability : int {
+  DURABILITY_DEFAULT = 0,
+  DURABILITY_NONE = 1,
+  DURABILITY_PERIODIC = 2,
+  DURABILITY_ALWAYS = 3,
+  Durability_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Durability_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Durability_IsValid(int value);
+constexpr Durability Durability_MIN = DURABILITY_DEFAULT;
+constexpr Durability Durability_MAX = DURABILITY_ALWAYS;
+constexpr int Durability_ARRAYSIZE = Durability_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Durability_descriptor();
+template<typename T>
+inline const std::string& Durability_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Durability>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Durability_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Durability_descriptor(), enum_t_value);
+}
+inline bool Durability_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Durability* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Durability>(
+    Durability_descriptor(), name, value);
+}
 // ===================================================================
 
 class ReplicaKey final :
@@ -400,7 +452,7 @@ class Value final :
   std::string* _internal_mutable_value();
   public:
 
-  // string lseq = 2;
+  // bytes lseq = 2;
   void clear_lseq();
   const std::string& lseq() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
@@ -554,7 +606,7 @@ class LSeq final :
   enum : int {
     kLseqFieldNumber = 1,
   };
-  // string lseq = 1;
+  // bytes lseq = 1;
   void clear_lseq();
   const std::string& lseq() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
@@ -709,8 +761,9 @@ class EventsRequest final :
     kKeyFieldNumber = 3,
     kReplicaIdFieldNumber = 1,
     kLimitFieldNumber = 4,
+    kChunkBytesFieldNumber = 5,
   };
-  // optional string lseq = 2;
+  // optional bytes lseq = 2;
   bool has_lseq() const;
   private:
   bool _internal_has_lseq() const;
@@ -768,6 +821,19 @@ class EventsRequest final :
   void _internal_set_limit(uint32_t value);
   public:
 
+  // optional uint32 chunk_bytes = 5;
+  bool has_chunk_bytes() const;
+  private:
+  bool _internal_has_chunk_bytes() const;
+  public:
+  void clear_chunk_bytes();
+  uint32_t chunk_bytes() const;
+  void set_chunk_bytes(uint32_t value);
+  private:
+  uint32_t _internal_chunk_bytes() const;
+  void _internal_set_chunk_bytes(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:lseqdb.EventsRequest)
  private:
   class _Internal;
@@ -782,6 +848,196 @@ class EventsRequest final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
     int32_t replica_id_;
     uint32_t limit_;
+    uint32_t chunk_bytes_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lseqDb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class WatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.WatchRequest) */ {
+ public:
+  inline WatchRequest() : WatchRequest(nullptr) {}
+  ~WatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR WatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  WatchRequest(const WatchRequest& from);
+  WatchRequest(WatchRequest&& from) noexcept
+    : WatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline WatchRequest& operator=(const WatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline WatchRequest& operator=(WatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const WatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const WatchRequest* internal_default_instance() {
+    return reinterpret_cast<const WatchRequest*>(
+               &_WatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(WatchRequest& a, WatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(WatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(WatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  WatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<WatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const WatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const WatchRequest& from) {
+    WatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(WatchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lseqdb.WatchRequest";
+  }
+  protected:
+  explicit WatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFromLseqFieldNumber = 2,
+    kKeyFieldNumber = 3,
+    kReplicaIdFieldNumber = 1,
+  };
+  // optional bytes from_lseq = 2;
+  bool has_from_lseq() const;
+  private:
+  bool _internal_has_from_lseq() const;
+  public:
+  void clear_from_lseq();
+  const std::string& from_lseq() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_from_lseq(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_from_lseq();
+  PROTOBUF_NODISCARD std::string* release_from_lseq();
+  void set_allocated_from_lseq(std::string* from_lseq);
+  private:
+  const std::string& _internal_from_lseq() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_from_lseq(const std::string& value);
+  std::string* _internal_mutable_from_lseq();
+  public:
+
+  // optional string key = 3;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // int32 replica_id = 1;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:lseqdb.WatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr from_lseq_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    int32_t replica_id_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_lseqDb_2eproto;
@@ -836,7 +1092,7 @@ class PutRequest final :
                &_PutRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(PutRequest& a, PutRequest& b) {
     a.Swap(&b);
@@ -911,6 +1167,7 @@ class PutRequest final :
   enum : int {
     kKeyFieldNumber = 1,
     kValueFieldNumber = 2,
+    kDurabilityFieldNumber = 3,
   };
   // string key = 1;
   void clear_key();
@@ -940,6 +1197,15 @@ class PutRequest final :
   std::string* _internal_mutable_value();
   public:
 
+  // .lseqdb.Durability durability = 3;
+  void clear_durability();
+  ::lseqdb::Durability durability() const;
+  void set_durability(::lseqdb::Durability value);
+  private:
+  ::lseqdb::Durability _internal_durability() const;
+  void _internal_set_durability(::lseqdb::Durability value);
+  public:
+
   // @@protoc_insertion_point(class_scope:lseqdb.PutRequest)
  private:
   class _Internal;
@@ -950,6 +1216,7 @@ class PutRequest final :
   struct Impl_ {
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    int durability_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1005,7 +1272,7 @@ class SeekGetRequest final :
                &_SeekGetRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
   friend void swap(SeekGetRequest& a, SeekGetRequest& b) {
     a.Swap(&b);
@@ -1081,8 +1348,9 @@ class SeekGetRequest final :
     kLseqFieldNumber = 1,
     kKeyFieldNumber = 2,
     kLimitFieldNumber = 3,
+    kChunkBytesFieldNumber = 4,
   };
-  // string lseq = 1;
+  // bytes lseq = 1;
   void clear_lseq();
   const std::string& lseq() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
@@ -1127,6 +1395,19 @@ class SeekGetRequest final :
   void _internal_set_limit(uint32_t value);
   public:
 
+  // optional uint32 chunk_bytes = 4;
+  bool has_chunk_bytes() const;
+  private:
+  bool _internal_has_chunk_bytes() const;
+  public:
+  void clear_chunk_bytes();
+  uint32_t chunk_bytes() const;
+  void set_chunk_bytes(uint32_t value);
+  private:
+  uint32_t _internal_chunk_bytes() const;
+  void _internal_set_chunk_bytes(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:lseqdb.SeekGetRequest)
  private:
   class _Internal;
@@ -1140,30 +1421,31 @@ class SeekGetRequest final :
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr lseq_;
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
     uint32_t limit_;
+    uint32_t chunk_bytes_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_lseqDb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DBItems_DbItem final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.DBItems.DbItem) */ {
+class ScanRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.ScanRequest) */ {
  public:
-  inline DBItems_DbItem() : DBItems_DbItem(nullptr) {}
-  ~DBItems_DbItem() override;
-  explicit PROTOBUF_CONSTEXPR DBItems_DbItem(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline ScanRequest() : ScanRequest(nullptr) {}
+  ~ScanRequest() override;
+  explicit PROTOBUF_CONSTEXPR ScanRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  DBItems_DbItem(const DBItems_DbItem& from);
-  DBItems_DbItem(DBItems_DbItem&& from) noexcept
-    : DBItems_DbItem() {
+  ScanRequest(const ScanRequest& from);
+  ScanRequest(ScanRequest&& from) noexcept
+    : ScanRequest() {
     *this = ::std::move(from);
   }
 
-  inline DBItems_DbItem& operator=(const DBItems_DbItem& from) {
+  inline ScanRequest& operator=(const ScanRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline DBItems_DbItem& operator=(DBItems_DbItem&& from) noexcept {
+  inline ScanRequest& operator=(ScanRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1186,20 +1468,20 @@ class DBItems_DbItem final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const DBItems_DbItem& default_instance() {
+  static const ScanRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const DBItems_DbItem* internal_default_instance() {
-    return reinterpret_cast<const DBItems_DbItem*>(
-               &_DBItems_DbItem_default_instance_);
+  static inline const ScanRequest* internal_default_instance() {
+    return reinterpret_cast<const ScanRequest*>(
+               &_ScanRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    7;
 
-  friend void swap(DBItems_DbItem& a, DBItems_DbItem& b) {
+  friend void swap(ScanRequest& a, ScanRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(DBItems_DbItem* other) {
+  inline void Swap(ScanRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1212,7 +1494,7 @@ class DBItems_DbItem final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(DBItems_DbItem* other) {
+  void UnsafeArenaSwap(ScanRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1220,14 +1502,14 @@ class DBItems_DbItem final :
 
   // implements Message ----------------------------------------------
 
-  DBItems_DbItem* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<DBItems_DbItem>(arena);
+  ScanRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ScanRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const DBItems_DbItem& from);
+  void CopyFrom(const ScanRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const DBItems_DbItem& from) {
-    DBItems_DbItem::MergeImpl(*this, from);
+  void MergeFrom( const ScanRequest& from) {
+    ScanRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1245,15 +1527,15 @@ class DBItems_DbItem final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(DBItems_DbItem* other);
+  void InternalSwap(ScanRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "lseqdb.DBItems.DbItem";
+    return "lseqdb.ScanRequest";
   }
   protected:
-  explicit DBItems_DbItem(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit ScanRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1267,53 +1549,85 @@ class DBItems_DbItem final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kLseqFieldNumber = 1,
-    kKeyFieldNumber = 2,
-    kValueFieldNumber = 3,
+    kStartFieldNumber = 1,
+    kEndFieldNumber = 2,
+    kPrefixFieldNumber = 3,
+    kReplicaIdFieldNumber = 4,
+    kLimitFieldNumber = 5,
   };
-  // string lseq = 1;
-  void clear_lseq();
-  const std::string& lseq() const;
+  // string start = 1;
+  void clear_start();
+  const std::string& start() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_lseq(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_lseq();
-  PROTOBUF_NODISCARD std::string* release_lseq();
-  void set_allocated_lseq(std::string* lseq);
+  void set_start(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_start();
+  PROTOBUF_NODISCARD std::string* release_start();
+  void set_allocated_start(std::string* start);
   private:
-  const std::string& _internal_lseq() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_lseq(const std::string& value);
-  std::string* _internal_mutable_lseq();
+  const std::string& _internal_start() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_start(const std::string& value);
+  std::string* _internal_mutable_start();
   public:
 
-  // string key = 2;
-  void clear_key();
-  const std::string& key() const;
+  // string end = 2;
+  void clear_end();
+  const std::string& end() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_key(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_key();
-  PROTOBUF_NODISCARD std::string* release_key();
-  void set_allocated_key(std::string* key);
+  void set_end(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_end();
+  PROTOBUF_NODISCARD std::string* release_end();
+  void set_allocated_end(std::string* end);
   private:
-  const std::string& _internal_key() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
-  std::string* _internal_mutable_key();
+  const std::string& _internal_end() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_end(const std::string& value);
+  std::string* _internal_mutable_end();
   public:
 
-  // string value = 3;
-  void clear_value();
-  const std::string& value() const;
+  // optional string prefix = 3;
+  bool has_prefix() const;
+  private:
+  bool _internal_has_prefix() const;
+  public:
+  void clear_prefix();
+  const std::string& prefix() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_value(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_value();
-  PROTOBUF_NODISCARD std::string* release_value();
-  void set_allocated_value(std::string* value);
+  void set_prefix(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_prefix();
+  PROTOBUF_NODISCARD std::string* release_prefix();
+  void set_allocated_prefix(std::string* prefix);
   private:
-  const std::string& _internal_value() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
-  std::string* _internal_mutable_value();
+  const std::string& _internal_prefix() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_prefix(const std::string& value);
+  std::string* _internal_mutable_prefix();
   public:
 
-  // @@protoc_insertion_point(class_scope:lseqdb.DBItems.DbItem)
+  // optional int32 replica_id = 4;
+  bool has_replica_id() const;
+  private:
+  bool _internal_has_replica_id() const;
+  public:
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // optional uint32 limit = 5;
+  bool has_limit() const;
+  private:
+  bool _internal_has_limit() const;
+  public:
+  void clear_limit();
+  uint32_t limit() const;
+  void set_limit(uint32_t value);
+  private:
+  uint32_t _internal_limit() const;
+  void _internal_set_limit(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:lseqdb.ScanRequest)
  private:
   class _Internal;
 
@@ -1321,34 +1635,37 @@ class DBItems_DbItem final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr lseq_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr start_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr end_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr prefix_;
+    int32_t replica_id_;
+    uint32_t limit_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_lseqDb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class DBItems final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.DBItems) */ {
+class MultiGetRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.MultiGetRequest) */ {
  public:
-  inline DBItems() : DBItems(nullptr) {}
-  ~DBItems() override;
-  explicit PROTOBUF_CONSTEXPR DBItems(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline MultiGetRequest() : MultiGetRequest(nullptr) {}
+  ~MultiGetRequest() override;
+  explicit PROTOBUF_CONSTEXPR MultiGetRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  DBItems(const DBItems& from);
-  DBItems(DBItems&& from) noexcept
-    : DBItems() {
+  MultiGetRequest(const MultiGetRequest& from);
+  MultiGetRequest(MultiGetRequest&& from) noexcept
+    : MultiGetRequest() {
     *this = ::std::move(from);
   }
 
-  inline DBItems& operator=(const DBItems& from) {
+  inline MultiGetRequest& operator=(const MultiGetRequest& from) {
     CopyFrom(from);
     return *this;
   }
-  inline DBItems& operator=(DBItems&& from) noexcept {
+  inline MultiGetRequest& operator=(MultiGetRequest&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1371,20 +1688,20 @@ class DBItems final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const DBItems& default_instance() {
+  static const MultiGetRequest& default_instance() {
     return *internal_default_instance();
   }
-  static inline const DBItems* internal_default_instance() {
-    return reinterpret_cast<const DBItems*>(
-               &_DBItems_default_instance_);
+  static inline const MultiGetRequest* internal_default_instance() {
+    return reinterpret_cast<const MultiGetRequest*>(
+               &_MultiGetRequest_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    8;
 
-  friend void swap(DBItems& a, DBItems& b) {
+  friend void swap(MultiGetRequest& a, MultiGetRequest& b) {
     a.Swap(&b);
   }
-  inline void Swap(DBItems* other) {
+  inline void Swap(MultiGetRequest* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1397,7 +1714,7 @@ class DBItems final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(DBItems* other) {
+  void UnsafeArenaSwap(MultiGetRequest* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1405,14 +1722,14 @@ class DBItems final :
 
   // implements Message ----------------------------------------------
 
-  DBItems* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<DBItems>(arena);
+  MultiGetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<MultiGetRequest>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const DBItems& from);
+  void CopyFrom(const MultiGetRequest& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const DBItems& from) {
-    DBItems::MergeImpl(*this, from);
+  void MergeFrom( const MultiGetRequest& from) {
+    MultiGetRequest::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1430,15 +1747,15 @@ class DBItems final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(DBItems* other);
+  void InternalSwap(MultiGetRequest* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "lseqdb.DBItems";
+    return "lseqdb.MultiGetRequest";
   }
   protected:
-  explicit DBItems(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit MultiGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1449,33 +1766,41 @@ class DBItems final :
 
   // nested types ----------------------------------------------------
 
-  typedef DBItems_DbItem DbItem;
-
   // accessors -------------------------------------------------------
 
   enum : int {
-    kItemsFieldNumber = 1,
+    kKeysFieldNumber = 1,
     kReplicaIdFieldNumber = 2,
   };
-  // repeated .lseqdb.DBItems.DbItem items = 1;
-  int items_size() const;
+  // repeated string keys = 1;
+  int keys_size() const;
   private:
-  int _internal_items_size() const;
+  int _internal_keys_size() const;
   public:
-  void clear_items();
-  ::lseqdb::DBItems_DbItem* mutable_items(int index);
-  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lseqdb::DBItems_DbItem >*
-      mutable_items();
+  void clear_keys();
+  const std::string& keys(int index) const;
+  std::string* mutable_keys(int index);
+  void set_keys(int index, const std::string& value);
+  void set_keys(int index, std::string&& value);
+  void set_keys(int index, const char* value);
+  void set_keys(int index, const char* value, size_t size);
+  std::string* add_keys();
+  void add_keys(const std::string& value);
+  void add_keys(std::string&& value);
+  void add_keys(const char* value);
+  void add_keys(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& keys() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_keys();
   private:
-  const ::lseqdb::DBItems_DbItem& _internal_items(int index) const;
-  ::lseqdb::DBItems_DbItem* _internal_add_items();
+  const std::string& _internal_keys(int index) const;
+  std::string* _internal_add_keys();
   public:
-  const ::lseqdb::DBItems_DbItem& items(int index) const;
-  ::lseqdb::DBItems_DbItem* add_items();
-  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lseqdb::DBItems_DbItem >&
-      items() const;
 
-  // int32 replica_id = 2;
+  // optional int32 replica_id = 2;
+  bool has_replica_id() const;
+  private:
+  bool _internal_has_replica_id() const;
+  public:
   void clear_replica_id();
   int32_t replica_id() const;
   void set_replica_id(int32_t value);
@@ -1484,7 +1809,7 @@ class DBItems final :
   void _internal_set_replica_id(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:lseqdb.DBItems)
+  // @@protoc_insertion_point(class_scope:lseqdb.MultiGetRequest)
  private:
   class _Internal;
 
@@ -1492,33 +1817,34 @@ class DBItems final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lseqdb::DBItems_DbItem > items_;
-    int32_t replica_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> keys_;
+    int32_t replica_id_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_lseqDb_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Config final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.Config) */ {
+class DBItems_DbItem final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.DBItems.DbItem) */ {
  public:
-  inline Config() : Config(nullptr) {}
-  ~Config() override;
-  explicit PROTOBUF_CONSTEXPR Config(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline DBItems_DbItem() : DBItems_DbItem(nullptr) {}
+  ~DBItems_DbItem() override;
+  explicit PROTOBUF_CONSTEXPR DBItems_DbItem(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Config(const Config& from);
-  Config(Config&& from) noexcept
-    : Config() {
+  DBItems_DbItem(const DBItems_DbItem& from);
+  DBItems_DbItem(DBItems_DbItem&& from) noexcept
+    : DBItems_DbItem() {
     *this = ::std::move(from);
   }
 
-  inline Config& operator=(const Config& from) {
+  inline DBItems_DbItem& operator=(const DBItems_DbItem& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Config& operator=(Config&& from) noexcept {
+  inline DBItems_DbItem& operator=(DBItems_DbItem&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1541,20 +1867,20 @@ class Config final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Config& default_instance() {
+  static const DBItems_DbItem& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Config* internal_default_instance() {
-    return reinterpret_cast<const Config*>(
-               &_Config_default_instance_);
+  static inline const DBItems_DbItem* internal_default_instance() {
+    return reinterpret_cast<const DBItems_DbItem*>(
+               &_DBItems_DbItem_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    9;
 
-  friend void swap(Config& a, Config& b) {
+  friend void swap(DBItems_DbItem& a, DBItems_DbItem& b) {
     a.Swap(&b);
   }
-  inline void Swap(Config* other) {
+  inline void Swap(DBItems_DbItem* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1567,7 +1893,7 @@ class Config final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Config* other) {
+  void UnsafeArenaSwap(DBItems_DbItem* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1575,14 +1901,14 @@ class Config final :
 
   // implements Message ----------------------------------------------
 
-  Config* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Config>(arena);
+  DBItems_DbItem* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DBItems_DbItem>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Config& from);
+  void CopyFrom(const DBItems_DbItem& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const Config& from) {
-    Config::MergeImpl(*this, from);
+  void MergeFrom( const DBItems_DbItem& from) {
+    DBItems_DbItem::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1600,15 +1926,15 @@ class Config final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Config* other);
+  void InternalSwap(DBItems_DbItem* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "lseqdb.Config";
+    return "lseqdb.DBItems.DbItem";
   }
   protected:
-  explicit Config(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit DBItems_DbItem(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1622,28 +1948,53 @@ class Config final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kSelfReplicaIdFieldNumber = 1,
-    kMaxReplicaIdFieldNumber = 2,
+    kLseqFieldNumber = 1,
+    kKeyFieldNumber = 2,
+    kValueFieldNumber = 3,
   };
-  // int32 self_replica_id = 1;
-  void clear_self_replica_id();
-  int32_t self_replica_id() const;
-  void set_self_replica_id(int32_t value);
+  // bytes lseq = 1;
+  void clear_lseq();
+  const std::string& lseq() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_lseq(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_lseq();
+  PROTOBUF_NODISCARD std::string* release_lseq();
+  void set_allocated_lseq(std::string* lseq);
   private:
-  int32_t _internal_self_replica_id() const;
-  void _internal_set_self_replica_id(int32_t value);
+  const std::string& _internal_lseq() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_lseq(const std::string& value);
+  std::string* _internal_mutable_lseq();
   public:
 
-  // int32 max_replica_id = 2;
-  void clear_max_replica_id();
-  int32_t max_replica_id() const;
-  void set_max_replica_id(int32_t value);
+  // bytes key = 2;
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
   private:
-  int32_t _internal_max_replica_id() const;
-  void _internal_set_max_replica_id(int32_t value);
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
   public:
 
-  // @@protoc_insertion_point(class_scope:lseqdb.Config)
+  // string value = 3;
+  void clear_value();
+  const std::string& value() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_value(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_value();
+  PROTOBUF_NODISCARD std::string* release_value();
+  void set_allocated_value(std::string* value);
+  private:
+  const std::string& _internal_value() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_value(const std::string& value);
+  std::string* _internal_mutable_value();
+  public:
+
+  // @@protoc_insertion_point(class_scope:lseqdb.DBItems.DbItem)
  private:
   class _Internal;
 
@@ -1651,8 +2002,9 @@ class Config final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
-    int32_t self_replica_id_;
-    int32_t max_replica_id_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr lseq_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr value_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
@@ -1660,24 +2012,24 @@ class Config final :
 };
 // -------------------------------------------------------------------
 
-class SyncGetRequest final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.SyncGetRequest) */ {
+class DBItems final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.DBItems) */ {
  public:
-  inline SyncGetRequest() : SyncGetRequest(nullptr) {}
-  ~SyncGetRequest() override;
-  explicit PROTOBUF_CONSTEXPR SyncGetRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline DBItems() : DBItems(nullptr) {}
+  ~DBItems() override;
+  explicit PROTOBUF_CONSTEXPR DBItems(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  SyncGetRequest(const SyncGetRequest& from);
-  SyncGetRequest(SyncGetRequest&& from) noexcept
-    : SyncGetRequest() {
+  DBItems(const DBItems& from);
+  DBItems(DBItems&& from) noexcept
+    : DBItems() {
     *this = ::std::move(from);
   }
 
-  inline SyncGetRequest& operator=(const SyncGetRequest& from) {
+  inline DBItems& operator=(const DBItems& from) {
     CopyFrom(from);
     return *this;
   }
-  inline SyncGetRequest& operator=(SyncGetRequest&& from) noexcept {
+  inline DBItems& operator=(DBItems&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1700,20 +2052,20 @@ class SyncGetRequest final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const SyncGetRequest& default_instance() {
+  static const DBItems& default_instance() {
     return *internal_default_instance();
   }
-  static inline const SyncGetRequest* internal_default_instance() {
-    return reinterpret_cast<const SyncGetRequest*>(
-               &_SyncGetRequest_default_instance_);
+  static inline const DBItems* internal_default_instance() {
+    return reinterpret_cast<const DBItems*>(
+               &_DBItems_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    10;
 
-  friend void swap(SyncGetRequest& a, SyncGetRequest& b) {
+  friend void swap(DBItems& a, DBItems& b) {
     a.Swap(&b);
   }
-  inline void Swap(SyncGetRequest* other) {
+  inline void Swap(DBItems* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1726,7 +2078,7 @@ class SyncGetRequest final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(SyncGetRequest* other) {
+  void UnsafeArenaSwap(DBItems* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1734,14 +2086,14 @@ class SyncGetRequest final :
 
   // implements Message ----------------------------------------------
 
-  SyncGetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<SyncGetRequest>(arena);
+  DBItems* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DBItems>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const SyncGetRequest& from);
+  void CopyFrom(const DBItems& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom( const SyncGetRequest& from) {
-    SyncGetRequest::MergeImpl(*this, from);
+  void MergeFrom( const DBItems& from) {
+    DBItems::MergeImpl(*this, from);
   }
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
@@ -1759,15 +2111,15 @@ class SyncGetRequest final :
   void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(SyncGetRequest* other);
+  void InternalSwap(DBItems* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "lseqdb.SyncGetRequest";
+    return "lseqdb.DBItems";
   }
   protected:
-  explicit SyncGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit DBItems(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1778,12 +2130,33 @@ class SyncGetRequest final :
 
   // nested types ----------------------------------------------------
 
+  typedef DBItems_DbItem DbItem;
+
   // accessors -------------------------------------------------------
 
   enum : int {
-    kReplicaIdFieldNumber = 1,
+    kItemsFieldNumber = 1,
+    kReplicaIdFieldNumber = 2,
   };
-  // int32 replica_id = 1;
+  // repeated .lseqdb.DBItems.DbItem items = 1;
+  int items_size() const;
+  private:
+  int _internal_items_size() const;
+  public:
+  void clear_items();
+  ::lseqdb::DBItems_DbItem* mutable_items(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lseqdb::DBItems_DbItem >*
+      mutable_items();
+  private:
+  const ::lseqdb::DBItems_DbItem& _internal_items(int index) const;
+  ::lseqdb::DBItems_DbItem* _internal_add_items();
+  public:
+  const ::lseqdb::DBItems_DbItem& items(int index) const;
+  ::lseqdb::DBItems_DbItem* add_items();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lseqdb::DBItems_DbItem >&
+      items() const;
+
+  // int32 replica_id = 2;
   void clear_replica_id();
   int32_t replica_id() const;
   void set_replica_id(int32_t value);
@@ -1792,7 +2165,7 @@ class SyncGetRequest final :
   void _internal_set_replica_id(int32_t value);
   public:
 
-  // @@protoc_insertion_point(class_scope:lseqdb.SyncGetRequest)
+  // @@protoc_insertion_point(class_scope:lseqdb.DBItems)
  private:
   class _Internal;
 
@@ -1800,63 +2173,1188 @@ class SyncGetRequest final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lseqdb::DBItems_DbItem > items_;
     int32_t replica_id_;
     mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   };
   union { Impl_ _impl_; };
   friend struct ::TableStruct_lseqDb_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class SyncAck final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.SyncAck) */ {
+ public:
+  inline SyncAck() : SyncAck(nullptr) {}
+  ~SyncAck() override;
+  explicit PROTOBUF_CONSTEXPR SyncAck(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-// ===================================================================
+  SyncAck(const SyncAck& from);
+  SyncAck(SyncAck&& from) noexcept
+    : SyncAck() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
+  inline SyncAck& operator=(const SyncAck& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncAck& operator=(SyncAck&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncAck& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncAck* internal_default_instance() {
+    return reinterpret_cast<const SyncAck*>(
+               &_SyncAck_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(SyncAck& a, SyncAck& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncAck* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncAck* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncAck* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncAck>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncAck& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncAck& from) {
+    SyncAck::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncAck* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lseqdb.SyncAck";
+  }
+  protected:
+  explicit SyncAck(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kAppliedLseqFieldNumber = 1,
+  };
+  // bytes applied_lseq = 1;
+  void clear_applied_lseq();
+  const std::string& applied_lseq() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_applied_lseq(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_applied_lseq();
+  PROTOBUF_NODISCARD std::string* release_applied_lseq();
+  void set_allocated_applied_lseq(std::string* applied_lseq);
+  private:
+  const std::string& _internal_applied_lseq() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_applied_lseq(const std::string& value);
+  std::string* _internal_mutable_applied_lseq();
+  public:
+
+  // @@protoc_insertion_point(class_scope:lseqdb.SyncAck)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr applied_lseq_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lseqDb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SeqVector_Entry final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.SeqVector.Entry) */ {
+ public:
+  inline SeqVector_Entry() : SeqVector_Entry(nullptr) {}
+  ~SeqVector_Entry() override;
+  explicit PROTOBUF_CONSTEXPR SeqVector_Entry(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SeqVector_Entry(const SeqVector_Entry& from);
+  SeqVector_Entry(SeqVector_Entry&& from) noexcept
+    : SeqVector_Entry() {
+    *this = ::std::move(from);
+  }
+
+  inline SeqVector_Entry& operator=(const SeqVector_Entry& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SeqVector_Entry& operator=(SeqVector_Entry&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SeqVector_Entry& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SeqVector_Entry* internal_default_instance() {
+    return reinterpret_cast<const SeqVector_Entry*>(
+               &_SeqVector_Entry_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(SeqVector_Entry& a, SeqVector_Entry& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SeqVector_Entry* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SeqVector_Entry* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SeqVector_Entry* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SeqVector_Entry>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SeqVector_Entry& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SeqVector_Entry& from) {
+    SeqVector_Entry::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SeqVector_Entry* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lseqdb.SeqVector.Entry";
+  }
+  protected:
+  explicit SeqVector_Entry(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSeqFieldNumber = 2,
+    kReplicaIdFieldNumber = 1,
+  };
+  // uint64 seq = 2;
+  void clear_seq();
+  uint64_t seq() const;
+  void set_seq(uint64_t value);
+  private:
+  uint64_t _internal_seq() const;
+  void _internal_set_seq(uint64_t value);
+  public:
+
+  // int32 replica_id = 1;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:lseqdb.SeqVector.Entry)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t seq_;
+    int32_t replica_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lseqDb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SeqVector final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.SeqVector) */ {
+ public:
+  inline SeqVector() : SeqVector(nullptr) {}
+  ~SeqVector() override;
+  explicit PROTOBUF_CONSTEXPR SeqVector(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SeqVector(const SeqVector& from);
+  SeqVector(SeqVector&& from) noexcept
+    : SeqVector() {
+    *this = ::std::move(from);
+  }
+
+  inline SeqVector& operator=(const SeqVector& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SeqVector& operator=(SeqVector&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SeqVector& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SeqVector* internal_default_instance() {
+    return reinterpret_cast<const SeqVector*>(
+               &_SeqVector_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(SeqVector& a, SeqVector& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SeqVector* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SeqVector* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SeqVector* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SeqVector>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SeqVector& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SeqVector& from) {
+    SeqVector::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SeqVector* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lseqdb.SeqVector";
+  }
+  protected:
+  explicit SeqVector(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  typedef SeqVector_Entry Entry;
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEntriesFieldNumber = 1,
+  };
+  // repeated .lseqdb.SeqVector.Entry entries = 1;
+  int entries_size() const;
+  private:
+  int _internal_entries_size() const;
+  public:
+  void clear_entries();
+  ::lseqdb::SeqVector_Entry* mutable_entries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lseqdb::SeqVector_Entry >*
+      mutable_entries();
+  private:
+  const ::lseqdb::SeqVector_Entry& _internal_entries(int index) const;
+  ::lseqdb::SeqVector_Entry* _internal_add_entries();
+  public:
+  const ::lseqdb::SeqVector_Entry& entries(int index) const;
+  ::lseqdb::SeqVector_Entry* add_entries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lseqdb::SeqVector_Entry >&
+      entries() const;
+
+  // @@protoc_insertion_point(class_scope:lseqdb.SeqVector)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lseqdb::SeqVector_Entry > entries_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lseqDb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Config final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.Config) */ {
+ public:
+  inline Config() : Config(nullptr) {}
+  ~Config() override;
+  explicit PROTOBUF_CONSTEXPR Config(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Config(const Config& from);
+  Config(Config&& from) noexcept
+    : Config() {
+    *this = ::std::move(from);
+  }
+
+  inline Config& operator=(const Config& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Config& operator=(Config&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Config& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Config* internal_default_instance() {
+    return reinterpret_cast<const Config*>(
+               &_Config_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(Config& a, Config& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Config* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Config* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Config* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Config>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Config& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Config& from) {
+    Config::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Config* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lseqdb.Config";
+  }
+  protected:
+  explicit Config(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSelfReplicaIdFieldNumber = 1,
+    kMaxReplicaIdFieldNumber = 2,
+  };
+  // int32 self_replica_id = 1;
+  void clear_self_replica_id();
+  int32_t self_replica_id() const;
+  void set_self_replica_id(int32_t value);
+  private:
+  int32_t _internal_self_replica_id() const;
+  void _internal_set_self_replica_id(int32_t value);
+  public:
+
+  // int32 max_replica_id = 2;
+  void clear_max_replica_id();
+  int32_t max_replica_id() const;
+  void set_max_replica_id(int32_t value);
+  private:
+  int32_t _internal_max_replica_id() const;
+  void _internal_set_max_replica_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:lseqdb.Config)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t self_replica_id_;
+    int32_t max_replica_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lseqDb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SyncGetRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:lseqdb.SyncGetRequest) */ {
+ public:
+  inline SyncGetRequest() : SyncGetRequest(nullptr) {}
+  ~SyncGetRequest() override;
+  explicit PROTOBUF_CONSTEXPR SyncGetRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SyncGetRequest(const SyncGetRequest& from);
+  SyncGetRequest(SyncGetRequest&& from) noexcept
+    : SyncGetRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SyncGetRequest& operator=(const SyncGetRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SyncGetRequest& operator=(SyncGetRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SyncGetRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SyncGetRequest* internal_default_instance() {
+    return reinterpret_cast<const SyncGetRequest*>(
+               &_SyncGetRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(SyncGetRequest& a, SyncGetRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SyncGetRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SyncGetRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SyncGetRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SyncGetRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SyncGetRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SyncGetRequest& from) {
+    SyncGetRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SyncGetRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "lseqdb.SyncGetRequest";
+  }
+  protected:
+  explicit SyncGetRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kReplicaIdFieldNumber = 1,
+  };
+  // int32 replica_id = 1;
+  void clear_replica_id();
+  int32_t replica_id() const;
+  void set_replica_id(int32_t value);
+  private:
+  int32_t _internal_replica_id() const;
+  void _internal_set_replica_id(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:lseqdb.SyncGetRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t replica_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_lseqDb_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
 // ReplicaKey
 
-// string key = 1;
-inline void ReplicaKey::clear_key() {
+// string key = 1;
+inline void ReplicaKey::clear_key() {
+  _impl_.key_.ClearToEmpty();
+}
+inline const std::string& ReplicaKey::key() const {
+  // @@protoc_insertion_point(field_get:lseqdb.ReplicaKey.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ReplicaKey::set_key(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.ReplicaKey.key)
+}
+inline std::string* ReplicaKey::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:lseqdb.ReplicaKey.key)
+  return _s;
+}
+inline const std::string& ReplicaKey::_internal_key() const {
+  return _impl_.key_.Get();
+}
+inline void ReplicaKey::_internal_set_key(const std::string& value) {
+  
+  _impl_.key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ReplicaKey::_internal_mutable_key() {
+  
+  return _impl_.key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ReplicaKey::release_key() {
+  // @@protoc_insertion_point(field_release:lseqdb.ReplicaKey.key)
+  return _impl_.key_.Release();
+}
+inline void ReplicaKey::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.ReplicaKey.key)
+}
+
+// optional int32 replica_id = 2;
+inline bool ReplicaKey::_internal_has_replica_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ReplicaKey::has_replica_id() const {
+  return _internal_has_replica_id();
+}
+inline void ReplicaKey::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t ReplicaKey::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t ReplicaKey::replica_id() const {
+  // @@protoc_insertion_point(field_get:lseqdb.ReplicaKey.replica_id)
+  return _internal_replica_id();
+}
+inline void ReplicaKey::_internal_set_replica_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.replica_id_ = value;
+}
+inline void ReplicaKey::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:lseqdb.ReplicaKey.replica_id)
+}
+
+// -------------------------------------------------------------------
+
+// Value
+
+// string value = 1;
+inline void Value::clear_value() {
+  _impl_.value_.ClearToEmpty();
+}
+inline const std::string& Value::value() const {
+  // @@protoc_insertion_point(field_get:lseqdb.Value.value)
+  return _internal_value();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Value::set_value(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.Value.value)
+}
+inline std::string* Value::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:lseqdb.Value.value)
+  return _s;
+}
+inline const std::string& Value::_internal_value() const {
+  return _impl_.value_.Get();
+}
+inline void Value::_internal_set_value(const std::string& value) {
+  
+  _impl_.value_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Value::_internal_mutable_value() {
+  
+  return _impl_.value_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Value::release_value() {
+  // @@protoc_insertion_point(field_release:lseqdb.Value.value)
+  return _impl_.value_.Release();
+}
+inline void Value::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.Value.value)
+}
+
+// bytes lseq = 2;
+inline void Value::clear_lseq() {
+  _impl_.lseq_.ClearToEmpty();
+}
+inline const std::string& Value::lseq() const {
+  // @@protoc_insertion_point(field_get:lseqdb.Value.lseq)
+  return _internal_lseq();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Value::set_lseq(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.lseq_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.Value.lseq)
+}
+inline std::string* Value::mutable_lseq() {
+  std::string* _s = _internal_mutable_lseq();
+  // @@protoc_insertion_point(field_mutable:lseqdb.Value.lseq)
+  return _s;
+}
+inline const std::string& Value::_internal_lseq() const {
+  return _impl_.lseq_.Get();
+}
+inline void Value::_internal_set_lseq(const std::string& value) {
+  
+  _impl_.lseq_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Value::_internal_mutable_lseq() {
+  
+  return _impl_.lseq_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Value::release_lseq() {
+  // @@protoc_insertion_point(field_release:lseqdb.Value.lseq)
+  return _impl_.lseq_.Release();
+}
+inline void Value::set_allocated_lseq(std::string* lseq) {
+  if (lseq != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.lseq_.SetAllocated(lseq, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.lseq_.IsDefault()) {
+    _impl_.lseq_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.Value.lseq)
+}
+
+// -------------------------------------------------------------------
+
+// LSeq
+
+// bytes lseq = 1;
+inline void LSeq::clear_lseq() {
+  _impl_.lseq_.ClearToEmpty();
+}
+inline const std::string& LSeq::lseq() const {
+  // @@protoc_insertion_point(field_get:lseqdb.LSeq.lseq)
+  return _internal_lseq();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void LSeq::set_lseq(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.lseq_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.LSeq.lseq)
+}
+inline std::string* LSeq::mutable_lseq() {
+  std::string* _s = _internal_mutable_lseq();
+  // @@protoc_insertion_point(field_mutable:lseqdb.LSeq.lseq)
+  return _s;
+}
+inline const std::string& LSeq::_internal_lseq() const {
+  return _impl_.lseq_.Get();
+}
+inline void LSeq::_internal_set_lseq(const std::string& value) {
+  
+  _impl_.lseq_.Set(value, GetArenaForAllocation());
+}
+inline std::string* LSeq::_internal_mutable_lseq() {
+  
+  return _impl_.lseq_.Mutable(GetArenaForAllocation());
+}
+inline std::string* LSeq::release_lseq() {
+  // @@protoc_insertion_point(field_release:lseqdb.LSeq.lseq)
+  return _impl_.lseq_.Release();
+}
+inline void LSeq::set_allocated_lseq(std::string* lseq) {
+  if (lseq != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.lseq_.SetAllocated(lseq, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.lseq_.IsDefault()) {
+    _impl_.lseq_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.LSeq.lseq)
+}
+
+// -------------------------------------------------------------------
+
+// EventsRequest
+
+// int32 replica_id = 1;
+inline void EventsRequest::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+}
+inline int32_t EventsRequest::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t EventsRequest::replica_id() const {
+  // @@protoc_insertion_point(field_get:lseqdb.EventsRequest.replica_id)
+  return _internal_replica_id();
+}
+inline void EventsRequest::_internal_set_replica_id(int32_t value) {
+  
+  _impl_.replica_id_ = value;
+}
+inline void EventsRequest::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:lseqdb.EventsRequest.replica_id)
+}
+
+// optional bytes lseq = 2;
+inline bool EventsRequest::_internal_has_lseq() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool EventsRequest::has_lseq() const {
+  return _internal_has_lseq();
+}
+inline void EventsRequest::clear_lseq() {
+  _impl_.lseq_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& EventsRequest::lseq() const {
+  // @@protoc_insertion_point(field_get:lseqdb.EventsRequest.lseq)
+  return _internal_lseq();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void EventsRequest::set_lseq(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.lseq_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.EventsRequest.lseq)
+}
+inline std::string* EventsRequest::mutable_lseq() {
+  std::string* _s = _internal_mutable_lseq();
+  // @@protoc_insertion_point(field_mutable:lseqdb.EventsRequest.lseq)
+  return _s;
+}
+inline const std::string& EventsRequest::_internal_lseq() const {
+  return _impl_.lseq_.Get();
+}
+inline void EventsRequest::_internal_set_lseq(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.lseq_.Set(value, GetArenaForAllocation());
+}
+inline std::string* EventsRequest::_internal_mutable_lseq() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.lseq_.Mutable(GetArenaForAllocation());
+}
+inline std::string* EventsRequest::release_lseq() {
+  // @@protoc_insertion_point(field_release:lseqdb.EventsRequest.lseq)
+  if (!_internal_has_lseq()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.lseq_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.lseq_.IsDefault()) {
+    _impl_.lseq_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void EventsRequest::set_allocated_lseq(std::string* lseq) {
+  if (lseq != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.lseq_.SetAllocated(lseq, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.lseq_.IsDefault()) {
+    _impl_.lseq_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.EventsRequest.lseq)
+}
+
+// optional string key = 3;
+inline bool EventsRequest::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool EventsRequest::has_key() const {
+  return _internal_has_key();
+}
+inline void EventsRequest::clear_key() {
   _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline const std::string& ReplicaKey::key() const {
-  // @@protoc_insertion_point(field_get:lseqdb.ReplicaKey.key)
+inline const std::string& EventsRequest::key() const {
+  // @@protoc_insertion_point(field_get:lseqdb.EventsRequest.key)
   return _internal_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void ReplicaKey::set_key(ArgT0&& arg0, ArgT... args) {
- 
+void EventsRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
  _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:lseqdb.ReplicaKey.key)
+  // @@protoc_insertion_point(field_set:lseqdb.EventsRequest.key)
 }
-inline std::string* ReplicaKey::mutable_key() {
+inline std::string* EventsRequest::mutable_key() {
   std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:lseqdb.ReplicaKey.key)
+  // @@protoc_insertion_point(field_mutable:lseqdb.EventsRequest.key)
   return _s;
 }
-inline const std::string& ReplicaKey::_internal_key() const {
+inline const std::string& EventsRequest::_internal_key() const {
   return _impl_.key_.Get();
 }
-inline void ReplicaKey::_internal_set_key(const std::string& value) {
-  
+inline void EventsRequest::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
   _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* ReplicaKey::_internal_mutable_key() {
-  
+inline std::string* EventsRequest::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
   return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* ReplicaKey::release_key() {
-  // @@protoc_insertion_point(field_release:lseqdb.ReplicaKey.key)
-  return _impl_.key_.Release();
+inline std::string* EventsRequest::release_key() {
+  // @@protoc_insertion_point(field_release:lseqdb.EventsRequest.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void ReplicaKey::set_allocated_key(std::string* key) {
+inline void EventsRequest::set_allocated_key(std::string* key) {
   if (key != nullptr) {
-    
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
   _impl_.key_.SetAllocated(key, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -1864,277 +3362,393 @@ inline void ReplicaKey::set_allocated_key(std::string* key) {
     _impl_.key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:lseqdb.ReplicaKey.key)
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.EventsRequest.key)
 }
 
-// optional int32 replica_id = 2;
-inline bool ReplicaKey::_internal_has_replica_id() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+// optional uint32 limit = 4;
+inline bool EventsRequest::_internal_has_limit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
-inline bool ReplicaKey::has_replica_id() const {
-  return _internal_has_replica_id();
+inline bool EventsRequest::has_limit() const {
+  return _internal_has_limit();
 }
-inline void ReplicaKey::clear_replica_id() {
+inline void EventsRequest::clear_limit() {
+  _impl_.limit_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t EventsRequest::_internal_limit() const {
+  return _impl_.limit_;
+}
+inline uint32_t EventsRequest::limit() const {
+  // @@protoc_insertion_point(field_get:lseqdb.EventsRequest.limit)
+  return _internal_limit();
+}
+inline void EventsRequest::_internal_set_limit(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.limit_ = value;
+}
+inline void EventsRequest::set_limit(uint32_t value) {
+  _internal_set_limit(value);
+  // @@protoc_insertion_point(field_set:lseqdb.EventsRequest.limit)
+}
+
+// optional uint32 chunk_bytes = 5;
+inline bool EventsRequest::_internal_has_chunk_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool EventsRequest::has_chunk_bytes() const {
+  return _internal_has_chunk_bytes();
+}
+inline void EventsRequest::clear_chunk_bytes() {
+  _impl_.chunk_bytes_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000008u;
+}
+inline uint32_t EventsRequest::_internal_chunk_bytes() const {
+  return _impl_.chunk_bytes_;
+}
+inline uint32_t EventsRequest::chunk_bytes() const {
+  // @@protoc_insertion_point(field_get:lseqdb.EventsRequest.chunk_bytes)
+  return _internal_chunk_bytes();
+}
+inline void EventsRequest::_internal_set_chunk_bytes(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000008u;
+  _impl_.chunk_bytes_ = value;
+}
+inline void EventsRequest::set_chunk_bytes(uint32_t value) {
+  _internal_set_chunk_bytes(value);
+  // @@protoc_insertion_point(field_set:lseqdb.EventsRequest.chunk_bytes)
+}
+
+// -------------------------------------------------------------------
+
+// WatchRequest
+
+// int32 replica_id = 1;
+inline void WatchRequest::clear_replica_id() {
   _impl_.replica_id_ = 0;
-  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline int32_t ReplicaKey::_internal_replica_id() const {
+inline int32_t WatchRequest::_internal_replica_id() const {
   return _impl_.replica_id_;
 }
-inline int32_t ReplicaKey::replica_id() const {
-  // @@protoc_insertion_point(field_get:lseqdb.ReplicaKey.replica_id)
+inline int32_t WatchRequest::replica_id() const {
+  // @@protoc_insertion_point(field_get:lseqdb.WatchRequest.replica_id)
   return _internal_replica_id();
 }
-inline void ReplicaKey::_internal_set_replica_id(int32_t value) {
-  _impl_._has_bits_[0] |= 0x00000001u;
+inline void WatchRequest::_internal_set_replica_id(int32_t value) {
+  
   _impl_.replica_id_ = value;
 }
-inline void ReplicaKey::set_replica_id(int32_t value) {
+inline void WatchRequest::set_replica_id(int32_t value) {
   _internal_set_replica_id(value);
-  // @@protoc_insertion_point(field_set:lseqdb.ReplicaKey.replica_id)
+  // @@protoc_insertion_point(field_set:lseqdb.WatchRequest.replica_id)
 }
 
-// -------------------------------------------------------------------
-
-// Value
+// optional bytes from_lseq = 2;
+inline bool WatchRequest::_internal_has_from_lseq() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool WatchRequest::has_from_lseq() const {
+  return _internal_has_from_lseq();
+}
+inline void WatchRequest::clear_from_lseq() {
+  _impl_.from_lseq_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& WatchRequest::from_lseq() const {
+  // @@protoc_insertion_point(field_get:lseqdb.WatchRequest.from_lseq)
+  return _internal_from_lseq();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void WatchRequest::set_from_lseq(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
+ _impl_.from_lseq_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.WatchRequest.from_lseq)
+}
+inline std::string* WatchRequest::mutable_from_lseq() {
+  std::string* _s = _internal_mutable_from_lseq();
+  // @@protoc_insertion_point(field_mutable:lseqdb.WatchRequest.from_lseq)
+  return _s;
+}
+inline const std::string& WatchRequest::_internal_from_lseq() const {
+  return _impl_.from_lseq_.Get();
+}
+inline void WatchRequest::_internal_set_from_lseq(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.from_lseq_.Set(value, GetArenaForAllocation());
+}
+inline std::string* WatchRequest::_internal_mutable_from_lseq() {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  return _impl_.from_lseq_.Mutable(GetArenaForAllocation());
+}
+inline std::string* WatchRequest::release_from_lseq() {
+  // @@protoc_insertion_point(field_release:lseqdb.WatchRequest.from_lseq)
+  if (!_internal_has_from_lseq()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000001u;
+  auto* p = _impl_.from_lseq_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.from_lseq_.IsDefault()) {
+    _impl_.from_lseq_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void WatchRequest::set_allocated_from_lseq(std::string* from_lseq) {
+  if (from_lseq != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000001u;
+  } else {
+    _impl_._has_bits_[0] &= ~0x00000001u;
+  }
+  _impl_.from_lseq_.SetAllocated(from_lseq, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.from_lseq_.IsDefault()) {
+    _impl_.from_lseq_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.WatchRequest.from_lseq)
+}
 
-// string value = 1;
-inline void Value::clear_value() {
-  _impl_.value_.ClearToEmpty();
+// optional string key = 3;
+inline bool WatchRequest::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+  return value;
 }
-inline const std::string& Value::value() const {
-  // @@protoc_insertion_point(field_get:lseqdb.Value.value)
-  return _internal_value();
+inline bool WatchRequest::has_key() const {
+  return _internal_has_key();
+}
+inline void WatchRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& WatchRequest::key() const {
+  // @@protoc_insertion_point(field_get:lseqdb.WatchRequest.key)
+  return _internal_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Value::set_value(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:lseqdb.Value.value)
+void WatchRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000002u;
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.WatchRequest.key)
 }
-inline std::string* Value::mutable_value() {
-  std::string* _s = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:lseqdb.Value.value)
+inline std::string* WatchRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:lseqdb.WatchRequest.key)
   return _s;
 }
-inline const std::string& Value::_internal_value() const {
-  return _impl_.value_.Get();
+inline const std::string& WatchRequest::_internal_key() const {
+  return _impl_.key_.Get();
 }
-inline void Value::_internal_set_value(const std::string& value) {
-  
-  _impl_.value_.Set(value, GetArenaForAllocation());
+inline void WatchRequest::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Value::_internal_mutable_value() {
-  
-  return _impl_.value_.Mutable(GetArenaForAllocation());
+inline std::string* WatchRequest::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Value::release_value() {
-  // @@protoc_insertion_point(field_release:lseqdb.Value.value)
-  return _impl_.value_.Release();
+inline std::string* WatchRequest::release_key() {
+  // @@protoc_insertion_point(field_release:lseqdb.WatchRequest.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _impl_._has_bits_[0] &= ~0x00000002u;
+  auto* p = _impl_.key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
 }
-inline void Value::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
-    
+inline void WatchRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _impl_._has_bits_[0] |= 0x00000002u;
   } else {
-    
+    _impl_._has_bits_[0] &= ~0x00000002u;
   }
-  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.value_.IsDefault()) {
-    _impl_.value_.Set("", GetArenaForAllocation());
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:lseqdb.Value.value)
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.WatchRequest.key)
 }
 
-// string lseq = 2;
-inline void Value::clear_lseq() {
-  _impl_.lseq_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// PutRequest
+
+// string key = 1;
+inline void PutRequest::clear_key() {
+  _impl_.key_.ClearToEmpty();
 }
-inline const std::string& Value::lseq() const {
-  // @@protoc_insertion_point(field_get:lseqdb.Value.lseq)
-  return _internal_lseq();
+inline const std::string& PutRequest::key() const {
+  // @@protoc_insertion_point(field_get:lseqdb.PutRequest.key)
+  return _internal_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Value::set_lseq(ArgT0&& arg0, ArgT... args) {
+void PutRequest::set_key(ArgT0&& arg0, ArgT... args) {
  
- _impl_.lseq_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:lseqdb.Value.lseq)
+ _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.PutRequest.key)
 }
-inline std::string* Value::mutable_lseq() {
-  std::string* _s = _internal_mutable_lseq();
-  // @@protoc_insertion_point(field_mutable:lseqdb.Value.lseq)
+inline std::string* PutRequest::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:lseqdb.PutRequest.key)
   return _s;
 }
-inline const std::string& Value::_internal_lseq() const {
-  return _impl_.lseq_.Get();
+inline const std::string& PutRequest::_internal_key() const {
+  return _impl_.key_.Get();
 }
-inline void Value::_internal_set_lseq(const std::string& value) {
+inline void PutRequest::_internal_set_key(const std::string& value) {
   
-  _impl_.lseq_.Set(value, GetArenaForAllocation());
+  _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Value::_internal_mutable_lseq() {
+inline std::string* PutRequest::_internal_mutable_key() {
   
-  return _impl_.lseq_.Mutable(GetArenaForAllocation());
+  return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Value::release_lseq() {
-  // @@protoc_insertion_point(field_release:lseqdb.Value.lseq)
-  return _impl_.lseq_.Release();
+inline std::string* PutRequest::release_key() {
+  // @@protoc_insertion_point(field_release:lseqdb.PutRequest.key)
+  return _impl_.key_.Release();
 }
-inline void Value::set_allocated_lseq(std::string* lseq) {
-  if (lseq != nullptr) {
+inline void PutRequest::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
     
   } else {
     
   }
-  _impl_.lseq_.SetAllocated(lseq, GetArenaForAllocation());
+  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.lseq_.IsDefault()) {
-    _impl_.lseq_.Set("", GetArenaForAllocation());
+  if (_impl_.key_.IsDefault()) {
+    _impl_.key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:lseqdb.Value.lseq)
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.PutRequest.key)
 }
 
-// -------------------------------------------------------------------
-
-// LSeq
-
-// string lseq = 1;
-inline void LSeq::clear_lseq() {
-  _impl_.lseq_.ClearToEmpty();
+// string value = 2;
+inline void PutRequest::clear_value() {
+  _impl_.value_.ClearToEmpty();
 }
-inline const std::string& LSeq::lseq() const {
-  // @@protoc_insertion_point(field_get:lseqdb.LSeq.lseq)
-  return _internal_lseq();
+inline const std::string& PutRequest::value() const {
+  // @@protoc_insertion_point(field_get:lseqdb.PutRequest.value)
+  return _internal_value();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void LSeq::set_lseq(ArgT0&& arg0, ArgT... args) {
+void PutRequest::set_value(ArgT0&& arg0, ArgT... args) {
  
- _impl_.lseq_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:lseqdb.LSeq.lseq)
+ _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.PutRequest.value)
 }
-inline std::string* LSeq::mutable_lseq() {
-  std::string* _s = _internal_mutable_lseq();
-  // @@protoc_insertion_point(field_mutable:lseqdb.LSeq.lseq)
+inline std::string* PutRequest::mutable_value() {
+  std::string* _s = _internal_mutable_value();
+  // @@protoc_insertion_point(field_mutable:lseqdb.PutRequest.value)
   return _s;
 }
-inline const std::string& LSeq::_internal_lseq() const {
-  return _impl_.lseq_.Get();
+inline const std::string& PutRequest::_internal_value() const {
+  return _impl_.value_.Get();
 }
-inline void LSeq::_internal_set_lseq(const std::string& value) {
+inline void PutRequest::_internal_set_value(const std::string& value) {
   
-  _impl_.lseq_.Set(value, GetArenaForAllocation());
+  _impl_.value_.Set(value, GetArenaForAllocation());
 }
-inline std::string* LSeq::_internal_mutable_lseq() {
+inline std::string* PutRequest::_internal_mutable_value() {
   
-  return _impl_.lseq_.Mutable(GetArenaForAllocation());
+  return _impl_.value_.Mutable(GetArenaForAllocation());
 }
-inline std::string* LSeq::release_lseq() {
-  // @@protoc_insertion_point(field_release:lseqdb.LSeq.lseq)
-  return _impl_.lseq_.Release();
+inline std::string* PutRequest::release_value() {
+  // @@protoc_insertion_point(field_release:lseqdb.PutRequest.value)
+  return _impl_.value_.Release();
 }
-inline void LSeq::set_allocated_lseq(std::string* lseq) {
-  if (lseq != nullptr) {
+inline void PutRequest::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
     
   } else {
     
   }
-  _impl_.lseq_.SetAllocated(lseq, GetArenaForAllocation());
+  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.lseq_.IsDefault()) {
-    _impl_.lseq_.Set("", GetArenaForAllocation());
+  if (_impl_.value_.IsDefault()) {
+    _impl_.value_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:lseqdb.LSeq.lseq)
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.PutRequest.value)
 }
 
-// -------------------------------------------------------------------
-
-// EventsRequest
-
-// int32 replica_id = 1;
-inline void EventsRequest::clear_replica_id() {
-  _impl_.replica_id_ = 0;
+// .lseqdb.Durability durability = 3;
+inline void PutRequest::clear_durability() {
+  _impl_.durability_ = 0;
 }
-inline int32_t EventsRequest::_internal_replica_id() const {
-  return _impl_.replica_id_;
+inline ::lseqdb::Durability PutRequest::_internal_durability() const {
+  return static_cast< ::lseqdb::Durability >(_impl_.durability_);
 }
-inline int32_t EventsRequest::replica_id() const {
-  // @@protoc_insertion_point(field_get:lseqdb.EventsRequest.replica_id)
-  return _internal_replica_id();
+inline ::lseqdb::Durability PutRequest::durability() const {
+  // @@protoc_insertion_point(field_get:lseqdb.PutRequest.durability)
+  return _internal_durability();
 }
-inline void EventsRequest::_internal_set_replica_id(int32_t value) {
+inline void PutRequest::_internal_set_durability(::lseqdb::Durability value) {
   
-  _impl_.replica_id_ = value;
+  _impl_.durability_ = value;
 }
-inline void EventsRequest::set_replica_id(int32_t value) {
-  _internal_set_replica_id(value);
-  // @@protoc_insertion_point(field_set:lseqdb.EventsRequest.replica_id)
+inline void PutRequest::set_durability(::lseqdb::Durability value) {
+  _internal_set_durability(value);
+  // @@protoc_insertion_point(field_set:lseqdb.PutRequest.durability)
 }
 
-// optional string lseq = 2;
-inline bool EventsRequest::_internal_has_lseq() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
-  return value;
-}
-inline bool EventsRequest::has_lseq() const {
-  return _internal_has_lseq();
-}
-inline void EventsRequest::clear_lseq() {
+// -------------------------------------------------------------------
+
+// SeekGetRequest
+
+// bytes lseq = 1;
+inline void SeekGetRequest::clear_lseq() {
   _impl_.lseq_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& EventsRequest::lseq() const {
-  // @@protoc_insertion_point(field_get:lseqdb.EventsRequest.lseq)
+inline const std::string& SeekGetRequest::lseq() const {
+  // @@protoc_insertion_point(field_get:lseqdb.SeekGetRequest.lseq)
   return _internal_lseq();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void EventsRequest::set_lseq(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.lseq_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:lseqdb.EventsRequest.lseq)
+void SeekGetRequest::set_lseq(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.lseq_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.SeekGetRequest.lseq)
 }
-inline std::string* EventsRequest::mutable_lseq() {
+inline std::string* SeekGetRequest::mutable_lseq() {
   std::string* _s = _internal_mutable_lseq();
-  // @@protoc_insertion_point(field_mutable:lseqdb.EventsRequest.lseq)
+  // @@protoc_insertion_point(field_mutable:lseqdb.SeekGetRequest.lseq)
   return _s;
 }
-inline const std::string& EventsRequest::_internal_lseq() const {
+inline const std::string& SeekGetRequest::_internal_lseq() const {
   return _impl_.lseq_.Get();
 }
-inline void EventsRequest::_internal_set_lseq(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000001u;
+inline void SeekGetRequest::_internal_set_lseq(const std::string& value) {
+  
   _impl_.lseq_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EventsRequest::_internal_mutable_lseq() {
-  _impl_._has_bits_[0] |= 0x00000001u;
+inline std::string* SeekGetRequest::_internal_mutable_lseq() {
+  
   return _impl_.lseq_.Mutable(GetArenaForAllocation());
 }
-inline std::string* EventsRequest::release_lseq() {
-  // @@protoc_insertion_point(field_release:lseqdb.EventsRequest.lseq)
-  if (!_internal_has_lseq()) {
-    return nullptr;
-  }
-  _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.lseq_.Release();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.lseq_.IsDefault()) {
-    _impl_.lseq_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  return p;
+inline std::string* SeekGetRequest::release_lseq() {
+  // @@protoc_insertion_point(field_release:lseqdb.SeekGetRequest.lseq)
+  return _impl_.lseq_.Release();
 }
-inline void EventsRequest::set_allocated_lseq(std::string* lseq) {
+inline void SeekGetRequest::set_allocated_lseq(std::string* lseq) {
   if (lseq != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000001u;
+    
   } else {
-    _impl_._has_bits_[0] &= ~0x00000001u;
+    
   }
   _impl_.lseq_.SetAllocated(lseq, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -2142,54 +3756,54 @@ inline void EventsRequest::set_allocated_lseq(std::string* lseq) {
     _impl_.lseq_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:lseqdb.EventsRequest.lseq)
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.SeekGetRequest.lseq)
 }
 
-// optional string key = 3;
-inline bool EventsRequest::_internal_has_key() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
+// optional string key = 2;
+inline bool SeekGetRequest::_internal_has_key() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool EventsRequest::has_key() const {
+inline bool SeekGetRequest::has_key() const {
   return _internal_has_key();
 }
-inline void EventsRequest::clear_key() {
+inline void SeekGetRequest::clear_key() {
   _impl_.key_.ClearToEmpty();
-  _impl_._has_bits_[0] &= ~0x00000002u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& EventsRequest::key() const {
-  // @@protoc_insertion_point(field_get:lseqdb.EventsRequest.key)
+inline const std::string& SeekGetRequest::key() const {
+  // @@protoc_insertion_point(field_get:lseqdb.SeekGetRequest.key)
   return _internal_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void EventsRequest::set_key(ArgT0&& arg0, ArgT... args) {
- _impl_._has_bits_[0] |= 0x00000002u;
+void SeekGetRequest::set_key(ArgT0&& arg0, ArgT... args) {
+ _impl_._has_bits_[0] |= 0x00000001u;
  _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:lseqdb.EventsRequest.key)
+  // @@protoc_insertion_point(field_set:lseqdb.SeekGetRequest.key)
 }
-inline std::string* EventsRequest::mutable_key() {
+inline std::string* SeekGetRequest::mutable_key() {
   std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:lseqdb.EventsRequest.key)
+  // @@protoc_insertion_point(field_mutable:lseqdb.SeekGetRequest.key)
   return _s;
 }
-inline const std::string& EventsRequest::_internal_key() const {
+inline const std::string& SeekGetRequest::_internal_key() const {
   return _impl_.key_.Get();
 }
-inline void EventsRequest::_internal_set_key(const std::string& value) {
-  _impl_._has_bits_[0] |= 0x00000002u;
+inline void SeekGetRequest::_internal_set_key(const std::string& value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
   _impl_.key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* EventsRequest::_internal_mutable_key() {
-  _impl_._has_bits_[0] |= 0x00000002u;
+inline std::string* SeekGetRequest::_internal_mutable_key() {
+  _impl_._has_bits_[0] |= 0x00000001u;
   return _impl_.key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* EventsRequest::release_key() {
-  // @@protoc_insertion_point(field_release:lseqdb.EventsRequest.key)
+inline std::string* SeekGetRequest::release_key() {
+  // @@protoc_insertion_point(field_release:lseqdb.SeekGetRequest.key)
   if (!_internal_has_key()) {
     return nullptr;
   }
-  _impl_._has_bits_[0] &= ~0x00000002u;
+  _impl_._has_bits_[0] &= ~0x00000001u;
   auto* p = _impl_.key_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
   if (_impl_.key_.IsDefault()) {
@@ -2198,11 +3812,11 @@ inline std::string* EventsRequest::release_key() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void EventsRequest::set_allocated_key(std::string* key) {
+inline void SeekGetRequest::set_allocated_key(std::string* key) {
   if (key != nullptr) {
-    _impl_._has_bits_[0] |= 0x00000002u;
+    _impl_._has_bits_[0] |= 0x00000001u;
   } else {
-    _impl_._has_bits_[0] &= ~0x00000002u;
+    _impl_._has_bits_[0] &= ~0x00000001u;
   }
   _impl_.key_.SetAllocated(key, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -2210,296 +3824,405 @@ inline void EventsRequest::set_allocated_key(std::string* key) {
     _impl_.key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:lseqdb.EventsRequest.key)
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.SeekGetRequest.key)
 }
 
-// optional uint32 limit = 4;
-inline bool EventsRequest::_internal_has_limit() const {
-  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+// optional uint32 limit = 3;
+inline bool SeekGetRequest::_internal_has_limit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool EventsRequest::has_limit() const {
+inline bool SeekGetRequest::has_limit() const {
   return _internal_has_limit();
 }
-inline void EventsRequest::clear_limit() {
+inline void SeekGetRequest::clear_limit() {
   _impl_.limit_ = 0u;
-  _impl_._has_bits_[0] &= ~0x00000004u;
+  _impl_._has_bits_[0] &= ~0x00000002u;
 }
-inline uint32_t EventsRequest::_internal_limit() const {
+inline uint32_t SeekGetRequest::_internal_limit() const {
   return _impl_.limit_;
 }
-inline uint32_t EventsRequest::limit() const {
-  // @@protoc_insertion_point(field_get:lseqdb.EventsRequest.limit)
+inline uint32_t SeekGetRequest::limit() const {
+  // @@protoc_insertion_point(field_get:lseqdb.SeekGetRequest.limit)
   return _internal_limit();
 }
-inline void EventsRequest::_internal_set_limit(uint32_t value) {
-  _impl_._has_bits_[0] |= 0x00000004u;
+inline void SeekGetRequest::_internal_set_limit(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
   _impl_.limit_ = value;
 }
-inline void EventsRequest::set_limit(uint32_t value) {
+inline void SeekGetRequest::set_limit(uint32_t value) {
   _internal_set_limit(value);
-  // @@protoc_insertion_point(field_set:lseqdb.EventsRequest.limit)
+  // @@protoc_insertion_point(field_set:lseqdb.SeekGetRequest.limit)
 }
 
-// -------------------------------------------------------------------
-
-// PutRequest
-
-// string key = 1;
-inline void PutRequest::clear_key() {
-  _impl_.key_.ClearToEmpty();
-}
-inline const std::string& PutRequest::key() const {
-  // @@protoc_insertion_point(field_get:lseqdb.PutRequest.key)
-  return _internal_key();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void PutRequest::set_key(ArgT0&& arg0, ArgT... args) {
- 
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:lseqdb.PutRequest.key)
-}
-inline std::string* PutRequest::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:lseqdb.PutRequest.key)
-  return _s;
-}
-inline const std::string& PutRequest::_internal_key() const {
-  return _impl_.key_.Get();
-}
-inline void PutRequest::_internal_set_key(const std::string& value) {
-  
-  _impl_.key_.Set(value, GetArenaForAllocation());
-}
-inline std::string* PutRequest::_internal_mutable_key() {
-  
-  return _impl_.key_.Mutable(GetArenaForAllocation());
-}
-inline std::string* PutRequest::release_key() {
-  // @@protoc_insertion_point(field_release:lseqdb.PutRequest.key)
-  return _impl_.key_.Release();
+// optional uint32 chunk_bytes = 4;
+inline bool SeekGetRequest::_internal_has_chunk_bytes() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
 }
-inline void PutRequest::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
-    
-  } else {
-    
-  }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:lseqdb.PutRequest.key)
+inline bool SeekGetRequest::has_chunk_bytes() const {
+  return _internal_has_chunk_bytes();
+}
+inline void SeekGetRequest::clear_chunk_bytes() {
+  _impl_.chunk_bytes_ = 0u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
+}
+inline uint32_t SeekGetRequest::_internal_chunk_bytes() const {
+  return _impl_.chunk_bytes_;
+}
+inline uint32_t SeekGetRequest::chunk_bytes() const {
+  // @@protoc_insertion_point(field_get:lseqdb.SeekGetRequest.chunk_bytes)
+  return _internal_chunk_bytes();
+}
+inline void SeekGetRequest::_internal_set_chunk_bytes(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
+  _impl_.chunk_bytes_ = value;
+}
+inline void SeekGetRequest::set_chunk_bytes(uint32_t value) {
+  _internal_set_chunk_bytes(value);
+  // @@protoc_insertion_point(field_set:lseqdb.SeekGetRequest.chunk_bytes)
 }
 
-// string value = 2;
-inline void PutRequest::clear_value() {
-  _impl_.value_.ClearToEmpty();
+// -------------------------------------------------------------------
+
+// ScanRequest
+
+// string start = 1;
+inline void ScanRequest::clear_start() {
+  _impl_.start_.ClearToEmpty();
 }
-inline const std::string& PutRequest::value() const {
-  // @@protoc_insertion_point(field_get:lseqdb.PutRequest.value)
-  return _internal_value();
+inline const std::string& ScanRequest::start() const {
+  // @@protoc_insertion_point(field_get:lseqdb.ScanRequest.start)
+  return _internal_start();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void PutRequest::set_value(ArgT0&& arg0, ArgT... args) {
+void ScanRequest::set_start(ArgT0&& arg0, ArgT... args) {
  
- _impl_.value_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:lseqdb.PutRequest.value)
+ _impl_.start_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.ScanRequest.start)
 }
-inline std::string* PutRequest::mutable_value() {
-  std::string* _s = _internal_mutable_value();
-  // @@protoc_insertion_point(field_mutable:lseqdb.PutRequest.value)
+inline std::string* ScanRequest::mutable_start() {
+  std::string* _s = _internal_mutable_start();
+  // @@protoc_insertion_point(field_mutable:lseqdb.ScanRequest.start)
   return _s;
 }
-inline const std::string& PutRequest::_internal_value() const {
-  return _impl_.value_.Get();
+inline const std::string& ScanRequest::_internal_start() const {
+  return _impl_.start_.Get();
 }
-inline void PutRequest::_internal_set_value(const std::string& value) {
+inline void ScanRequest::_internal_set_start(const std::string& value) {
   
-  _impl_.value_.Set(value, GetArenaForAllocation());
+  _impl_.start_.Set(value, GetArenaForAllocation());
 }
-inline std::string* PutRequest::_internal_mutable_value() {
+inline std::string* ScanRequest::_internal_mutable_start() {
   
-  return _impl_.value_.Mutable(GetArenaForAllocation());
+  return _impl_.start_.Mutable(GetArenaForAllocation());
 }
-inline std::string* PutRequest::release_value() {
-  // @@protoc_insertion_point(field_release:lseqdb.PutRequest.value)
-  return _impl_.value_.Release();
+inline std::string* ScanRequest::release_start() {
+  // @@protoc_insertion_point(field_release:lseqdb.ScanRequest.start)
+  return _impl_.start_.Release();
 }
-inline void PutRequest::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
+inline void ScanRequest::set_allocated_start(std::string* start) {
+  if (start != nullptr) {
     
   } else {
     
   }
-  _impl_.value_.SetAllocated(value, GetArenaForAllocation());
+  _impl_.start_.SetAllocated(start, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.value_.IsDefault()) {
-    _impl_.value_.Set("", GetArenaForAllocation());
+  if (_impl_.start_.IsDefault()) {
+    _impl_.start_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:lseqdb.PutRequest.value)
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.ScanRequest.start)
 }
 
-// -------------------------------------------------------------------
-
-// SeekGetRequest
-
-// string lseq = 1;
-inline void SeekGetRequest::clear_lseq() {
-  _impl_.lseq_.ClearToEmpty();
+// string end = 2;
+inline void ScanRequest::clear_end() {
+  _impl_.end_.ClearToEmpty();
 }
-inline const std::string& SeekGetRequest::lseq() const {
-  // @@protoc_insertion_point(field_get:lseqdb.SeekGetRequest.lseq)
-  return _internal_lseq();
+inline const std::string& ScanRequest::end() const {
+  // @@protoc_insertion_point(field_get:lseqdb.ScanRequest.end)
+  return _internal_end();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SeekGetRequest::set_lseq(ArgT0&& arg0, ArgT... args) {
+void ScanRequest::set_end(ArgT0&& arg0, ArgT... args) {
  
- _impl_.lseq_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:lseqdb.SeekGetRequest.lseq)
+ _impl_.end_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.ScanRequest.end)
 }
-inline std::string* SeekGetRequest::mutable_lseq() {
-  std::string* _s = _internal_mutable_lseq();
-  // @@protoc_insertion_point(field_mutable:lseqdb.SeekGetRequest.lseq)
+inline std::string* ScanRequest::mutable_end() {
+  std::string* _s = _internal_mutable_end();
+  // @@protoc_insertion_point(field_mutable:lseqdb.ScanRequest.end)
   return _s;
 }
-inline const std::string& SeekGetRequest::_internal_lseq() const {
-  return _impl_.lseq_.Get();
+inline const std::string& ScanRequest::_internal_end() const {
+  return _impl_.end_.Get();
 }
-inline void SeekGetRequest::_internal_set_lseq(const std::string& value) {
+inline void ScanRequest::_internal_set_end(const std::string& value) {
   
-  _impl_.lseq_.Set(value, GetArenaForAllocation());
+  _impl_.end_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SeekGetRequest::_internal_mutable_lseq() {
+inline std::string* ScanRequest::_internal_mutable_end() {
   
-  return _impl_.lseq_.Mutable(GetArenaForAllocation());
+  return _impl_.end_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SeekGetRequest::release_lseq() {
-  // @@protoc_insertion_point(field_release:lseqdb.SeekGetRequest.lseq)
-  return _impl_.lseq_.Release();
+inline std::string* ScanRequest::release_end() {
+  // @@protoc_insertion_point(field_release:lseqdb.ScanRequest.end)
+  return _impl_.end_.Release();
 }
-inline void SeekGetRequest::set_allocated_lseq(std::string* lseq) {
-  if (lseq != nullptr) {
+inline void ScanRequest::set_allocated_end(std::string* end) {
+  if (end != nullptr) {
     
   } else {
     
   }
-  _impl_.lseq_.SetAllocated(lseq, GetArenaForAllocation());
+  _impl_.end_.SetAllocated(end, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.lseq_.IsDefault()) {
-    _impl_.lseq_.Set("", GetArenaForAllocation());
+  if (_impl_.end_.IsDefault()) {
+    _impl_.end_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:lseqdb.SeekGetRequest.lseq)
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.ScanRequest.end)
 }
 
-// optional string key = 2;
-inline bool SeekGetRequest::_internal_has_key() const {
+// optional string prefix = 3;
+inline bool ScanRequest::_internal_has_prefix() const {
   bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool SeekGetRequest::has_key() const {
-  return _internal_has_key();
+inline bool ScanRequest::has_prefix() const {
+  return _internal_has_prefix();
 }
-inline void SeekGetRequest::clear_key() {
-  _impl_.key_.ClearToEmpty();
+inline void ScanRequest::clear_prefix() {
+  _impl_.prefix_.ClearToEmpty();
   _impl_._has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& SeekGetRequest::key() const {
-  // @@protoc_insertion_point(field_get:lseqdb.SeekGetRequest.key)
-  return _internal_key();
+inline const std::string& ScanRequest::prefix() const {
+  // @@protoc_insertion_point(field_get:lseqdb.ScanRequest.prefix)
+  return _internal_prefix();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void SeekGetRequest::set_key(ArgT0&& arg0, ArgT... args) {
+void ScanRequest::set_prefix(ArgT0&& arg0, ArgT... args) {
  _impl_._has_bits_[0] |= 0x00000001u;
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:lseqdb.SeekGetRequest.key)
+ _impl_.prefix_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.ScanRequest.prefix)
 }
-inline std::string* SeekGetRequest::mutable_key() {
-  std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:lseqdb.SeekGetRequest.key)
+inline std::string* ScanRequest::mutable_prefix() {
+  std::string* _s = _internal_mutable_prefix();
+  // @@protoc_insertion_point(field_mutable:lseqdb.ScanRequest.prefix)
   return _s;
 }
-inline const std::string& SeekGetRequest::_internal_key() const {
-  return _impl_.key_.Get();
+inline const std::string& ScanRequest::_internal_prefix() const {
+  return _impl_.prefix_.Get();
 }
-inline void SeekGetRequest::_internal_set_key(const std::string& value) {
+inline void ScanRequest::_internal_set_prefix(const std::string& value) {
   _impl_._has_bits_[0] |= 0x00000001u;
-  _impl_.key_.Set(value, GetArenaForAllocation());
+  _impl_.prefix_.Set(value, GetArenaForAllocation());
 }
-inline std::string* SeekGetRequest::_internal_mutable_key() {
+inline std::string* ScanRequest::_internal_mutable_prefix() {
   _impl_._has_bits_[0] |= 0x00000001u;
-  return _impl_.key_.Mutable(GetArenaForAllocation());
+  return _impl_.prefix_.Mutable(GetArenaForAllocation());
 }
-inline std::string* SeekGetRequest::release_key() {
-  // @@protoc_insertion_point(field_release:lseqdb.SeekGetRequest.key)
-  if (!_internal_has_key()) {
+inline std::string* ScanRequest::release_prefix() {
+  // @@protoc_insertion_point(field_release:lseqdb.ScanRequest.prefix)
+  if (!_internal_has_prefix()) {
     return nullptr;
   }
   _impl_._has_bits_[0] &= ~0x00000001u;
-  auto* p = _impl_.key_.Release();
+  auto* p = _impl_.prefix_.Release();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void SeekGetRequest::set_allocated_key(std::string* key) {
-  if (key != nullptr) {
+inline void ScanRequest::set_allocated_prefix(std::string* prefix) {
+  if (prefix != nullptr) {
     _impl_._has_bits_[0] |= 0x00000001u;
   } else {
     _impl_._has_bits_[0] &= ~0x00000001u;
   }
-  _impl_.key_.SetAllocated(key, GetArenaForAllocation());
+  _impl_.prefix_.SetAllocated(prefix, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (_impl_.key_.IsDefault()) {
-    _impl_.key_.Set("", GetArenaForAllocation());
+  if (_impl_.prefix_.IsDefault()) {
+    _impl_.prefix_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:lseqdb.SeekGetRequest.key)
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.ScanRequest.prefix)
 }
 
-// optional uint32 limit = 3;
-inline bool SeekGetRequest::_internal_has_limit() const {
+// optional int32 replica_id = 4;
+inline bool ScanRequest::_internal_has_replica_id() const {
   bool value = (_impl_._has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool SeekGetRequest::has_limit() const {
+inline bool ScanRequest::has_replica_id() const {
+  return _internal_has_replica_id();
+}
+inline void ScanRequest::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000002u;
+}
+inline int32_t ScanRequest::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t ScanRequest::replica_id() const {
+  // @@protoc_insertion_point(field_get:lseqdb.ScanRequest.replica_id)
+  return _internal_replica_id();
+}
+inline void ScanRequest::_internal_set_replica_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000002u;
+  _impl_.replica_id_ = value;
+}
+inline void ScanRequest::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:lseqdb.ScanRequest.replica_id)
+}
+
+// optional uint32 limit = 5;
+inline bool ScanRequest::_internal_has_limit() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool ScanRequest::has_limit() const {
   return _internal_has_limit();
 }
-inline void SeekGetRequest::clear_limit() {
+inline void ScanRequest::clear_limit() {
   _impl_.limit_ = 0u;
-  _impl_._has_bits_[0] &= ~0x00000002u;
+  _impl_._has_bits_[0] &= ~0x00000004u;
 }
-inline uint32_t SeekGetRequest::_internal_limit() const {
+inline uint32_t ScanRequest::_internal_limit() const {
   return _impl_.limit_;
 }
-inline uint32_t SeekGetRequest::limit() const {
-  // @@protoc_insertion_point(field_get:lseqdb.SeekGetRequest.limit)
+inline uint32_t ScanRequest::limit() const {
+  // @@protoc_insertion_point(field_get:lseqdb.ScanRequest.limit)
   return _internal_limit();
 }
-inline void SeekGetRequest::_internal_set_limit(uint32_t value) {
-  _impl_._has_bits_[0] |= 0x00000002u;
+inline void ScanRequest::_internal_set_limit(uint32_t value) {
+  _impl_._has_bits_[0] |= 0x00000004u;
   _impl_.limit_ = value;
 }
-inline void SeekGetRequest::set_limit(uint32_t value) {
+inline void ScanRequest::set_limit(uint32_t value) {
   _internal_set_limit(value);
-  // @@protoc_insertion_point(field_set:lseqdb.SeekGetRequest.limit)
+  // @@protoc_insertion_point(field_set:lseqdb.ScanRequest.limit)
+}
+
+// -------------------------------------------------------------------
+
+// MultiGetRequest
+
+// repeated string keys = 1;
+inline int MultiGetRequest::_internal_keys_size() const {
+  return _impl_.keys_.size();
+}
+inline int MultiGetRequest::keys_size() const {
+  return _internal_keys_size();
+}
+inline void MultiGetRequest::clear_keys() {
+  _impl_.keys_.Clear();
+}
+inline std::string* MultiGetRequest::add_keys() {
+  std::string* _s = _internal_add_keys();
+  // @@protoc_insertion_point(field_add_mutable:lseqdb.MultiGetRequest.keys)
+  return _s;
+}
+inline const std::string& MultiGetRequest::_internal_keys(int index) const {
+  return _impl_.keys_.Get(index);
+}
+inline const std::string& MultiGetRequest::keys(int index) const {
+  // @@protoc_insertion_point(field_get:lseqdb.MultiGetRequest.keys)
+  return _internal_keys(index);
+}
+inline std::string* MultiGetRequest::mutable_keys(int index) {
+  // @@protoc_insertion_point(field_mutable:lseqdb.MultiGetRequest.keys)
+  return _impl_.keys_.Mutable(index);
+}
+inline void MultiGetRequest::set_keys(int index, const std::string& value) {
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:lseqdb.MultiGetRequest.keys)
+}
+inline void MultiGetRequest::set_keys(int index, std::string&& value) {
+  _impl_.keys_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:lseqdb.MultiGetRequest.keys)
+}
+inline void MultiGetRequest::set_keys(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:lseqdb.MultiGetRequest.keys)
+}
+inline void MultiGetRequest::set_keys(int index, const char* value, size_t size) {
+  _impl_.keys_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:lseqdb.MultiGetRequest.keys)
+}
+inline std::string* MultiGetRequest::_internal_add_keys() {
+  return _impl_.keys_.Add();
+}
+inline void MultiGetRequest::add_keys(const std::string& value) {
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:lseqdb.MultiGetRequest.keys)
+}
+inline void MultiGetRequest::add_keys(std::string&& value) {
+  _impl_.keys_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:lseqdb.MultiGetRequest.keys)
+}
+inline void MultiGetRequest::add_keys(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  _impl_.keys_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:lseqdb.MultiGetRequest.keys)
+}
+inline void MultiGetRequest::add_keys(const char* value, size_t size) {
+  _impl_.keys_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:lseqdb.MultiGetRequest.keys)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+MultiGetRequest::keys() const {
+  // @@protoc_insertion_point(field_list:lseqdb.MultiGetRequest.keys)
+  return _impl_.keys_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+MultiGetRequest::mutable_keys() {
+  // @@protoc_insertion_point(field_mutable_list:lseqdb.MultiGetRequest.keys)
+  return &_impl_.keys_;
+}
+
+// optional int32 replica_id = 2;
+inline bool MultiGetRequest::_internal_has_replica_id() const {
+  bool value = (_impl_._has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool MultiGetRequest::has_replica_id() const {
+  return _internal_has_replica_id();
+}
+inline void MultiGetRequest::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+  _impl_._has_bits_[0] &= ~0x00000001u;
+}
+inline int32_t MultiGetRequest::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t MultiGetRequest::replica_id() const {
+  // @@protoc_insertion_point(field_get:lseqdb.MultiGetRequest.replica_id)
+  return _internal_replica_id();
+}
+inline void MultiGetRequest::_internal_set_replica_id(int32_t value) {
+  _impl_._has_bits_[0] |= 0x00000001u;
+  _impl_.replica_id_ = value;
+}
+inline void MultiGetRequest::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:lseqdb.MultiGetRequest.replica_id)
 }
 
 // -------------------------------------------------------------------
 
 // DBItems_DbItem
 
-// string lseq = 1;
+// bytes lseq = 1;
 inline void DBItems_DbItem::clear_lseq() {
   _impl_.lseq_.ClearToEmpty();
 }
@@ -2511,7 +4234,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void DBItems_DbItem::set_lseq(ArgT0&& arg0, ArgT... args) {
  
- _impl_.lseq_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.lseq_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:lseqdb.DBItems.DbItem.lseq)
 }
 inline std::string* DBItems_DbItem::mutable_lseq() {
@@ -2549,7 +4272,7 @@ inline void DBItems_DbItem::set_allocated_lseq(std::string* lseq) {
   // @@protoc_insertion_point(field_set_allocated:lseqdb.DBItems.DbItem.lseq)
 }
 
-// string key = 2;
+// bytes key = 2;
 inline void DBItems_DbItem::clear_key() {
   _impl_.key_.ClearToEmpty();
 }
@@ -2561,7 +4284,7 @@ template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
 void DBItems_DbItem::set_key(ArgT0&& arg0, ArgT... args) {
  
- _impl_.key_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+ _impl_.key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
   // @@protoc_insertion_point(field_set:lseqdb.DBItems.DbItem.key)
 }
 inline std::string* DBItems_DbItem::mutable_key() {
@@ -2715,6 +4438,148 @@ inline void DBItems::set_replica_id(int32_t value) {
 
 // -------------------------------------------------------------------
 
+// SyncAck
+
+// bytes applied_lseq = 1;
+inline void SyncAck::clear_applied_lseq() {
+  _impl_.applied_lseq_.ClearToEmpty();
+}
+inline const std::string& SyncAck::applied_lseq() const {
+  // @@protoc_insertion_point(field_get:lseqdb.SyncAck.applied_lseq)
+  return _internal_applied_lseq();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SyncAck::set_applied_lseq(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.applied_lseq_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:lseqdb.SyncAck.applied_lseq)
+}
+inline std::string* SyncAck::mutable_applied_lseq() {
+  std::string* _s = _internal_mutable_applied_lseq();
+  // @@protoc_insertion_point(field_mutable:lseqdb.SyncAck.applied_lseq)
+  return _s;
+}
+inline const std::string& SyncAck::_internal_applied_lseq() const {
+  return _impl_.applied_lseq_.Get();
+}
+inline void SyncAck::_internal_set_applied_lseq(const std::string& value) {
+  
+  _impl_.applied_lseq_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SyncAck::_internal_mutable_applied_lseq() {
+  
+  return _impl_.applied_lseq_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SyncAck::release_applied_lseq() {
+  // @@protoc_insertion_point(field_release:lseqdb.SyncAck.applied_lseq)
+  return _impl_.applied_lseq_.Release();
+}
+inline void SyncAck::set_allocated_applied_lseq(std::string* applied_lseq) {
+  if (applied_lseq != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.applied_lseq_.SetAllocated(applied_lseq, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.applied_lseq_.IsDefault()) {
+    _impl_.applied_lseq_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:lseqdb.SyncAck.applied_lseq)
+}
+
+// -------------------------------------------------------------------
+
+// SeqVector_Entry
+
+// int32 replica_id = 1;
+inline void SeqVector_Entry::clear_replica_id() {
+  _impl_.replica_id_ = 0;
+}
+inline int32_t SeqVector_Entry::_internal_replica_id() const {
+  return _impl_.replica_id_;
+}
+inline int32_t SeqVector_Entry::replica_id() const {
+  // @@protoc_insertion_point(field_get:lseqdb.SeqVector.Entry.replica_id)
+  return _internal_replica_id();
+}
+inline void SeqVector_Entry::_internal_set_replica_id(int32_t value) {
+  
+  _impl_.replica_id_ = value;
+}
+inline void SeqVector_Entry::set_replica_id(int32_t value) {
+  _internal_set_replica_id(value);
+  // @@protoc_insertion_point(field_set:lseqdb.SeqVector.Entry.replica_id)
+}
+
+// uint64 seq = 2;
+inline void SeqVector_Entry::clear_seq() {
+  _impl_.seq_ = uint64_t{0u};
+}
+inline uint64_t SeqVector_Entry::_internal_seq() const {
+  return _impl_.seq_;
+}
+inline uint64_t SeqVector_Entry::seq() const {
+  // @@protoc_insertion_point(field_get:lseqdb.SeqVector.Entry.seq)
+  return _internal_seq();
+}
+inline void SeqVector_Entry::_internal_set_seq(uint64_t value) {
+  
+  _impl_.seq_ = value;
+}
+inline void SeqVector_Entry::set_seq(uint64_t value) {
+  _internal_set_seq(value);
+  // @@protoc_insertion_point(field_set:lseqdb.SeqVector.Entry.seq)
+}
+
+// -------------------------------------------------------------------
+
+// SeqVector
+
+// repeated .lseqdb.SeqVector.Entry entries = 1;
+inline int SeqVector::_internal_entries_size() const {
+  return _impl_.entries_.size();
+}
+inline int SeqVector::entries_size() const {
+  return _internal_entries_size();
+}
+inline void SeqVector::clear_entries() {
+  _impl_.entries_.Clear();
+}
+inline ::lseqdb::SeqVector_Entry* SeqVector::mutable_entries(int index) {
+  // @@protoc_insertion_point(field_mutable:lseqdb.SeqVector.entries)
+  return _impl_.entries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lseqdb::SeqVector_Entry >*
+SeqVector::mutable_entries() {
+  // @@protoc_insertion_point(field_mutable_list:lseqdb.SeqVector.entries)
+  return &_impl_.entries_;
+}
+inline const ::lseqdb::SeqVector_Entry& SeqVector::_internal_entries(int index) const {
+  return _impl_.entries_.Get(index);
+}
+inline const ::lseqdb::SeqVector_Entry& SeqVector::entries(int index) const {
+  // @@protoc_insertion_point(field_get:lseqdb.SeqVector.entries)
+  return _internal_entries(index);
+}
+inline ::lseqdb::SeqVector_Entry* SeqVector::_internal_add_entries() {
+  return _impl_.entries_.Add();
+}
+inline ::lseqdb::SeqVector_Entry* SeqVector::add_entries() {
+  ::lseqdb::SeqVector_Entry* _add = _internal_add_entries();
+  // @@protoc_insertion_point(field_add:lseqdb.SeqVector.entries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::lseqdb::SeqVector_Entry >&
+SeqVector::entries() const {
+  // @@protoc_insertion_point(field_list:lseqdb.SeqVector.entries)
+  return _impl_.entries_;
+}
+
+// -------------------------------------------------------------------
+
 // Config
 
 // int32 self_replica_id = 1;
@@ -2802,11 +4667,33 @@ inline void SyncGetRequest::set_replica_id(int32_t value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
 }  // namespace lseqdb
 
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::lseqdb::Durability> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::lseqdb::Durability>() {
+  return ::lseqdb::Durability_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
 // @@protoc_insertion_point(global_scope)
 
 #include <google/protobuf/port_undef.inc>
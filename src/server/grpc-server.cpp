@@ -1,35 +1,111 @@
 #include "grpc-server.h"
 
-#include <grpcpp/client_context.h>
-#include <grpcpp/create_channel.h>
-#include <grpcpp/security/credentials.h>
-
+#include <limits>
 #include <stdexcept>
-#include <numeric>
 #include <algorithm>
-#include <random>
-#include <thread>
 #include <chrono>
 
 using namespace std::chrono_literals;
 
 using lseqdb::LSeqDatabase;
 
-using grpc::Channel;
-using grpc::ClientContext;
-using grpc::ClientReaderWriter;
 using grpc::ServerContext;
+using grpc::ServerReaderWriter;
+using grpc::ServerWriter;
 using grpc::Status;
 
 using lseqdb::Config;
 using lseqdb::DBItems;
 using lseqdb::EventsRequest;
 using lseqdb::LSeq;
+using lseqdb::MultiGetRequest;
 using lseqdb::PutRequest;
 using lseqdb::ReplicaKey;
+using lseqdb::ScanRequest;
 using lseqdb::SeekGetRequest;
+using lseqdb::SeqVector;
+using lseqdb::SyncAck;
 using lseqdb::SyncGetRequest;
 using lseqdb::Value;
+using lseqdb::WatchRequest;
+
+namespace {
+    //Size of one streamed message
+    constexpr size_t kChunkBytes = 1 << 20;
+    //How often a watcher without new events checks whether its client is gone
+    constexpr auto kWatchPollInterval = 200ms;
+    constexpr size_t kWatchMaxEvents = 1024;
+
+    SeekGetRequest EventsToSeekGet(const EventsRequest& request) {
+        SeekGetRequest req;
+        if (request.has_limit()) {
+            req.set_limit(request.limit());
+        }
+        if (request.has_key()) {
+            req.set_key(request.key());
+        }
+        if (request.has_lseq()) {
+            req.set_lseq(request.lseq());
+        } else {
+            req.set_lseq(dbConnector::generateLseqKey(0, request.replica_id()));
+        }
+        if (request.has_chunk_bytes()) {
+            req.set_chunk_bytes(request.chunk_bytes());
+        }
+        return req;
+    }
+
+    std::chrono::steady_clock::time_point SteadyDeadline(const ServerContext& context) {
+        auto deadline = context.deadline();
+        if (deadline == std::chrono::system_clock::time_point::max()) {
+            return std::chrono::steady_clock::time_point::max();
+        }
+        return std::chrono::steady_clock::now() +
+               std::chrono::duration_cast<std::chrono::steady_clock::duration>(deadline - std::chrono::system_clock::now());
+    }
+
+    void AddItem(DBItems& items, const batchValue& item) {
+        auto proto_item = items.add_items();
+        proto_item->set_lseq(item.lseq);
+        proto_item->set_key(dbConnector::stampedKeyToRealKey(item.key));
+        proto_item->set_value(item.value);
+    }
+
+    //Sends items of the cursor passing accept (all if it is empty) in chunks, holding one chunk at a time
+    Status StreamCursor(ServerContext* context, dbConnector::EventCursor& cursor, size_t limit, size_t chunkBytes,
+                        const std::function<bool(const batchValue&)>& accept, ServerWriter<DBItems>* writer) {
+        auto deadline = SteadyDeadline(*context);
+        batchValues chunk;
+        bool more = limit > 0;
+        while (more) {
+            chunk.clear();
+            more = cursor.next(chunk, limit, chunkBytes, deadline);
+            DBItems response;
+            for (const auto& item : chunk) {
+                if (!accept || accept(item)) {
+                    AddItem(response, item);
+                }
+            }
+            if (response.items_size() > 0) {
+                if (!writer->Write(response)) {
+                    return {grpc::StatusCode::CANCELLED, "stream closed by client"};
+                }
+                limit -= response.items_size();
+            }
+            if (!cursor.status().ok()) {
+                return {grpc::StatusCode::UNAVAILABLE, cursor.status().ToString()};
+            }
+            if (context->IsCancelled()) {
+                return {grpc::StatusCode::CANCELLED, "stream closed by client"};
+            }
+            if (cursor.timedOut()) {
+                return {grpc::StatusCode::DEADLINE_EXCEEDED, "deadline exceeded, continue after the last received lseq"};
+            }
+            more = more && limit > 0;
+        }
+        return Status::OK;
+    }
+}
 
 LSeqDatabaseImpl::LSeqDatabaseImpl(const YAMLConfig& config, dbConnector* database) : db(database), cfg(config) {
     syncMxs_.resize(config.getMaxReplicaId());
@@ -51,7 +127,21 @@ Status LSeqDatabaseImpl::GetValue(ServerContext* context, const ReplicaKey* requ
 }
 
 Status LSeqDatabaseImpl::Put(ServerContext* context, const PutRequest* request, LSeq* response) {
-    auto res = db->put(request->key(), request->value());
+    std::optional<Durability> durability;
+    switch (request->durability()) {
+        case lseqdb::DURABILITY_NONE:
+            durability = Durability::NONE;
+            break;
+        case lseqdb::DURABILITY_PERIODIC:
+            durability = Durability::PERIODIC;
+            break;
+        case lseqdb::DURABILITY_ALWAYS:
+            durability = Durability::ALWAYS;
+            break;
+        default:
+            break;
+    }
+    auto res = db->put(request->key(), request->value(), durability);
     if (!res.response_status.ok()) {
         return {grpc::StatusCode::ABORTED, res.response_status.ToString()};
     }
@@ -63,8 +153,11 @@ Status LSeqDatabaseImpl::SeekGet(ServerContext* context, const SeekGetRequest* r
     replyBatchFormat res;
     int limit = request->has_limit() ? static_cast<int>(request->limit()) : -1;
     const auto& lseq = request->lseq();
+    if (!dbConnector::isLseqKey(lseq)) {
+        return {grpc::StatusCode::INVALID_ARGUMENT, "malformed lseq"};
+    }
     if (request->has_key()) {
-        res = db->getValuesForKey(request->key(), dbConnector::lseqToSeq(lseq), std::stoi(dbConnector::lseqToReplicaId(lseq)), limit, dbConnector::LSEQ_COMPARE::GREATER);
+        res = db->getValuesForKey(request->key(), dbConnector::lseqToSeq(lseq), dbConnector::lseqToReplicaId(lseq), limit, dbConnector::LSEQ_COMPARE::GREATER);
     } else {
         res = db->getByLseq(lseq, limit, dbConnector::LSEQ_COMPARE::GREATER);
     }
@@ -82,19 +175,132 @@ Status LSeqDatabaseImpl::SeekGet(ServerContext* context, const SeekGetRequest* r
 }
 
 Status LSeqDatabaseImpl::GetReplicaEvents(ServerContext* context, const EventsRequest* request, DBItems* response) {
-    SeekGetRequest req;
-    if (request->has_limit()) {
-        req.set_limit(request->limit());
+    SeekGetRequest req = EventsToSeekGet(*request);
+    return SeekGet(context, &req, response);
+}
+
+Status LSeqDatabaseImpl::SeekGetStream(ServerContext* context, const SeekGetRequest* request, ServerWriter<DBItems>* writer) {
+    const auto& lseq = request->lseq();
+    if (!dbConnector::isLseqKey(lseq)) {
+        return {grpc::StatusCode::INVALID_ARGUMENT, "malformed lseq"};
     }
+    std::unique_ptr<dbConnector::EventCursor> cursor;
     if (request->has_key()) {
-        req.set_key(request->key());
+        cursor = db->keyCursor(request->key(), dbConnector::lseqToSeq(lseq), dbConnector::lseqToReplicaId(lseq), dbConnector::LSEQ_COMPARE::GREATER);
+    } else {
+        cursor = db->logCursor(lseq, dbConnector::LSEQ_COMPARE::GREATER);
+    }
+    size_t limit = request->has_limit() ? request->limit() : std::numeric_limits<size_t>::max();
+    size_t chunkBytes = request->chunk_bytes() > 0 ? request->chunk_bytes() : kChunkBytes;
+    return StreamCursor(context, *cursor, limit, chunkBytes, nullptr, writer);
+}
+
+Status LSeqDatabaseImpl::GetReplicaEventsStream(ServerContext* context, const EventsRequest* request, ServerWriter<DBItems>* writer) {
+    SeekGetRequest req = EventsToSeekGet(*request);
+    return SeekGetStream(context, &req, writer);
+}
+
+//Replays the log, then follows the event ring. The ring position is taken before the replay, so every event
+//committed after it is either replayed or found in the ring; the lseq of the last sent event drops duplicates
+Status LSeqDatabaseImpl::Watch(ServerContext* context, const WatchRequest* request, ServerWriter<DBItems>* writer) {
+    int replicaId = request->replica_id();
+    if (replicaId < 0 || replicaId >= cfg.getMaxReplicaId()) {
+        return {grpc::StatusCode::INVALID_ARGUMENT, "unknown replica id"};
+    }
+    std::string last = request->has_from_lseq() ? request->from_lseq() : dbConnector::generateLseqKey(0, replicaId);
+    if (!dbConnector::isLseqKey(last) || dbConnector::lseqToReplicaId(last) != replicaId) {
+        return {grpc::StatusCode::INVALID_ARGUMENT, "malformed lseq"};
+    }
+    auto accept = [&](const batchValue& item) {
+        if (dbConnector::lseqToReplicaId(item.lseq) != replicaId ||
+            dbConnector::lseqToSeq(item.lseq) <= dbConnector::lseqToSeq(last)) {
+            return false;
+        }
+        if (request->has_key() && dbConnector::stampedKeyToRealKey(item.key) != request->key()) {
+            return false;
+        }
+        last = item.lseq;
+        return true;
+    };
+    //Versions of one key are far fewer than the log of a replica
+    auto replay = [&]() {
+        std::unique_ptr<dbConnector::EventCursor> cursor;
+        if (request->has_key()) {
+            cursor = db->keyCursor(request->key(), dbConnector::lseqToSeq(last), replicaId, dbConnector::LSEQ_COMPARE::GREATER);
+        } else {
+            cursor = db->logCursor(last, dbConnector::LSEQ_COMPARE::GREATER);
+        }
+        return StreamCursor(context, *cursor, std::numeric_limits<size_t>::max(), kChunkBytes, accept, writer);
+    };
+
+    EventRing<batchValue>& ring = db->recentEvents();
+    uint64_t position = ring.end();
+    Status status = replay();
+    std::vector<EventRing<batchValue>::EventPtr> events;
+    while (status.ok()) {
+        if (context->IsCancelled()) {
+            return {grpc::StatusCode::CANCELLED, "stream closed by client"};
+        }
+        events.clear();
+        if (!ring.read(position, events, kWatchMaxEvents, std::chrono::steady_clock::now() + kWatchPollInterval)) {
+            //Fell behind the ring: the missed events are read from the log again
+            position = ring.end();
+            status = replay();
+            continue;
+        }
+        if (ring.isClosed()) {
+            return {grpc::StatusCode::UNAVAILABLE, "database is shutting down"};
+        }
+        DBItems response;
+        for (const auto& event : events) {
+            if (accept(*event)) {
+                AddItem(response, *event);
+            }
+        }
+        if (response.items_size() > 0 && !writer->Write(response)) {
+            return {grpc::StatusCode::CANCELLED, "stream closed by client"};
+        }
     }
-    if (request->has_lseq()) {
-        req.set_lseq(request->lseq());
+    return status;
+}
+
+Status LSeqDatabaseImpl::ScanRange(ServerContext* context, const ScanRequest* request, DBItems* response) {
+    replyBatchFormat res;
+    int limit = request->has_limit() ? static_cast<int>(request->limit()) : -1;
+    int replicaId = request->has_replica_id() ? request->replica_id() : cfg.getId();
+    if (request->has_prefix()) {
+        res = db->getPrefix(request->prefix(), replicaId, limit);
     } else {
-        req.set_lseq(dbConnector::generateLseqKey(0, request->replica_id()));
+        res = db->getRange(request->start(), request->end(), replicaId, limit);
     }
-    return SeekGet(context, &req, response);
+
+    if (!res.response_status.ok()) {
+        return {grpc::StatusCode::UNAVAILABLE, res.response_status.ToString()};
+    }
+    for (const auto& item : res.values) {
+        auto proto_item = response->add_items();
+        proto_item->set_lseq(item.lseq);
+        proto_item->set_key(dbConnector::stampedKeyToRealKey(item.key));
+        proto_item->set_value(item.value);
+    }
+    response->set_replica_id(replicaId);
+    return Status::OK;
+}
+
+Status LSeqDatabaseImpl::MultiGetValue(ServerContext* context, const MultiGetRequest* request, DBItems* response) {
+    int replicaId = request->has_replica_id() ? request->replica_id() : cfg.getId();
+    auto res = db->multiGet({request->keys().begin(), request->keys().end()}, replicaId);
+    if (!res.response_status.ok()) {
+        return {grpc::StatusCode::UNAVAILABLE, res.response_status.ToString()};
+    }
+    for (const auto& item : res.values) {
+        auto proto_item = response->add_items();
+        proto_item->set_lseq(item.lseq);
+        proto_item->set_key(dbConnector::stampedKeyToRealKey(item.key));
+        proto_item->set_value(item.value);
+    }
+    response->set_replica_id(replicaId);
+    return Status::OK;
 }
 
 Status LSeqDatabaseImpl::GetConfig(ServerContext* context, const ::google::protobuf::Empty*, Config* response) {
@@ -110,10 +316,50 @@ Status LSeqDatabaseImpl::SyncGet_(ServerContext* context, const SyncGetRequest*
 }
 
 Status LSeqDatabaseImpl::SyncPut_(ServerContext* context, const DBItems* request, ::google::protobuf::Empty* response) {
-    std::lock_guard<std::mutex> lockGuard(syncMxs_[request->replica_id()]);
+    return ApplySyncBatch(*request);
+}
+
+Status LSeqDatabaseImpl::SyncSeqs_(ServerContext* context, const SeqVector* request, SeqVector* response) {
+    for (const auto& entry : request->entries()) {
+        if (entry.replica_id() < 0 || entry.replica_id() >= cfg.getMaxReplicaId()) {
+            return {grpc::StatusCode::INVALID_ARGUMENT, "unknown replica id"};
+        }
+        auto seq = db->sequenceNumberForReplica(entry.replica_id());
+        if (seq > 0) {
+            auto* own = response->add_entries();
+            own->set_replica_id(entry.replica_id());
+            own->set_seq(seq);
+        }
+    }
+    return Status::OK;
+}
+
+Status LSeqDatabaseImpl::SyncStream(ServerContext* context, ServerReaderWriter<SyncAck, DBItems>* stream) {
+    DBItems chunk;
+    while (stream->Read(&chunk)) {
+        Status status = ApplySyncBatch(chunk);
+        if (!status.ok()) {
+            return status;
+        }
+        SyncAck ack;
+        if (chunk.items_size() > 0) {
+            ack.set_applied_lseq(chunk.items(chunk.items_size() - 1).lseq());
+        }
+        if (!stream->Write(ack)) {
+            return {grpc::StatusCode::CANCELLED, "stream closed by client"};
+        }
+    }
+    return Status::OK;
+}
+
+Status LSeqDatabaseImpl::ApplySyncBatch(const DBItems& request) {
+    if (request.replica_id() < 0 || request.replica_id() >= cfg.getMaxReplicaId()) {
+        return {grpc::StatusCode::INVALID_ARGUMENT, "unknown replica id"};
+    }
+    std::lock_guard<std::mutex> lockGuard(syncMxs_[request.replica_id()]);
     batchValues batch;
-    batch.reserve(request->items_size());
-    for (const auto& item : request->items()) {
+    batch.reserve(request.items_size());
+    for (const auto& item : request.items()) {
         batch.emplace_back(batchValue{item.lseq(), item.key(), item.value()});
     }
     auto res = db->putBatch(batch);
@@ -129,110 +375,15 @@ void RunServer(const YAMLConfig& config, dbConnector* database) {
 
     grpc::ServerBuilder builder;
     builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    //Peers keep their connections open and ping them while idle, see PeerConnections
+    builder.AddChannelArgument(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+    builder.AddChannelArgument(GRPC_ARG_HTTP2_MIN_RECV_PING_INTERVAL_WITHOUT_DATA_MS, 5000);
     builder.RegisterService(&service);
     std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
     std::cout << "Server listening on " << server_address << std::endl;
-    server->Wait();
-}
-
-std::string GetMaxLSeqFromRemoteReplica(const std::unique_ptr<LSeqDatabase::Stub>& client, size_t replicaId) {
-    ClientContext context;
-    SyncGetRequest request;
-    LSeq response;
-
-    request.set_replica_id(static_cast<int32_t>(replicaId));
-
-    Status status = client->SyncGet_(&context, request, &response);
-    if (!status.ok()) {
-        std::cerr << status.error_message() << std::endl;
-        return "";
-    }
-    return response.lseq();
-}
-
-DBItems DumpBatch(dbConnector* database, const std::string& lseq) {
-    auto res = database->getByLseq(lseq);
-    if (!res.response_status.ok()) {
-        return {};
-    }
-    DBItems batch;
-    for (const auto& item : res.values) {
-        auto proto_item = batch.add_items();
-        proto_item->set_lseq(item.lseq);
-        proto_item->set_key(item.key);
-        proto_item->set_value(item.value);
-    }
-    return batch;
-}
-
-bool SendNewBatch(const std::unique_ptr<LSeqDatabase::Stub>& client, const DBItems& batch) {
-    ClientContext context;
-    google::protobuf::Empty response;
-    auto deadline = std::chrono::system_clock::now() + std::chrono::milliseconds(500);
-    context.set_deadline(deadline);
-
-    Status status = client->SyncPut_(&context, batch, &response);
-    if (!status.ok()) {
-        std::cerr << status.error_message() << std::endl;
-        return false;
+    //Warmup started with the database and goes on while requests are served
+    if (!database->warmedUp()) {
+        std::cout << "Cache warmup continues in the background" << std::endl;
     }
-    return true;
+    server->Wait();
 }
-
-void SyncLoop(const YAMLConfig& config, dbConnector* database) {
-    const auto& replicas = config.getReplicas();
-    std::vector<size_t> replicaIds(replicas.size());
-    std::vector<size_t> syncOrder(config.getMaxReplicaId());
-    std::iota(replicaIds.begin(), replicaIds.end(), static_cast<size_t>(0));
-    std::iota(syncOrder.begin(), syncOrder.end(), static_cast<size_t>(0));
-
-    // Shuffle replicas for sync to reduce per-node load
-    std::random_device rd;
-    std::mt19937 rnd(rd());
-
-    std::shuffle(replicaIds.begin(), replicaIds.end(), rnd);
-    std::shuffle(syncOrder.begin(), syncOrder.end(), rnd);
-
-    // iterate over neighboring replicas in random order
-    for (auto i : replicaIds) {
-        // Connect to remote replica;
-        auto channel = grpc::CreateChannel(replicas[i], grpc::InsecureChannelCredentials());
-
-        std::unique_ptr<LSeqDatabase::Stub> client(LSeqDatabase::NewStub(channel));
-
-        // iterate over known replicas in random order
-        for (auto id : syncOrder) {
-            auto maxSeq = database->sequenceNumberForReplica(id);
-            if (maxSeq < 1) {
-                // no data from replica=id
-                continue;
-            }
-            auto remoteLSeq = GetMaxLSeqFromRemoteReplica(client, id);
-            if (remoteLSeq.empty()) {
-                // error
-                std::cerr << "Failed to get maxLSeq(" << id << ") from " << replicas[i] << std::endl;
-                continue;
-            }
-            auto remoteSeq = dbConnector::lseqToSeq(remoteLSeq);
-            if (maxSeq <= remoteSeq) {
-                // No new data
-                continue;
-            } else {
-                std::cout << "Trying to sync data from " << id << " with " << replicas[i] << "\n";
-                std::cout << "Current localMaxSeq(" << id << ")=" << maxSeq << "; "
-                          << "remoteMaxSeq(" << replicas[i] << ", " << id << ")=" << remoteSeq << std::endl;
-            }
-
-            auto newBatch = DumpBatch(database, remoteLSeq);
-            if (newBatch.items_size()) {
-                newBatch.set_replica_id(id);
-                if (!SendNewBatch(client, newBatch)) {
-                    std::cerr << "Failed to send batch to " << replicas[i] << std::endl;
-                } else {
-                    std::cout << "Data has been successfully synchronized" << std::endl;
-                }
-                std::this_thread::sleep_for(100ms);
-            }
-        }
-    }
-}
\ No newline at end of file
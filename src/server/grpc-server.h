@@ -5,6 +5,7 @@
 #include <string>
 #include <memory>
 #include <deque>
+#include <functional>
 #include <mutex>
 
 #include <grpc/grpc.h>
@@ -26,6 +27,11 @@ public:
     grpc::Status Put(grpc::ServerContext* context, const lseqdb::PutRequest* request, lseqdb::LSeq* response) override;
     grpc::Status SeekGet(grpc::ServerContext* context, const lseqdb::SeekGetRequest* request, lseqdb::DBItems* response) override;
     grpc::Status GetReplicaEvents(grpc::ServerContext* context, const lseqdb::EventsRequest* request, lseqdb::DBItems* response) override;
+    grpc::Status SeekGetStream(grpc::ServerContext* context, const lseqdb::SeekGetRequest* request, grpc::ServerWriter<lseqdb::DBItems>* writer) override;
+    grpc::Status GetReplicaEventsStream(grpc::ServerContext* context, const lseqdb::EventsRequest* request, grpc::ServerWriter<lseqdb::DBItems>* writer) override;
+    grpc::Status Watch(grpc::ServerContext* context, const lseqdb::WatchRequest* request, grpc::ServerWriter<lseqdb::DBItems>* writer) override;
+    grpc::Status ScanRange(grpc::ServerContext* context, const lseqdb::ScanRequest* request, lseqdb::DBItems* response) override;
+    grpc::Status MultiGetValue(grpc::ServerContext* context, const lseqdb::MultiGetRequest* request, lseqdb::DBItems* response) override;
 
 public:
     grpc::Status GetConfig(grpc::ServerContext* context, const ::google::protobuf::Empty*, lseqdb::Config* response) override;
@@ -33,7 +39,12 @@ public:
 public:
     grpc::Status SyncGet_(grpc::ServerContext* context, const lseqdb::SyncGetRequest* request, lseqdb::LSeq* response) override;
     grpc::Status SyncPut_(grpc::ServerContext* context, const lseqdb::DBItems* request, ::google::protobuf::Empty* response) override;
+    grpc::Status SyncSeqs_(grpc::ServerContext* context, const lseqdb::SeqVector* request, lseqdb::SeqVector* response) override;
+    grpc::Status SyncStream(grpc::ServerContext* context, grpc::ServerReaderWriter<lseqdb::SyncAck, lseqdb::DBItems>* stream) override;
 private:
+    //Batches of one replica are applied one at a time
+    grpc::Status ApplySyncBatch(const lseqdb::DBItems& batch);
+
     std::deque<std::mutex> syncMxs_;
 
 private:
@@ -42,4 +53,3 @@ private:
 };
 
 void RunServer(const YAMLConfig& config, dbConnector* database);
-void SyncLoop(const YAMLConfig& config, dbConnector* database);
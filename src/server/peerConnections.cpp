@@ -0,0 +1,57 @@
+#include "peerConnections.h"
+
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include <grpcpp/support/channel_arguments.h>
+
+#include <iostream>
+
+namespace {
+    //Idle connections are pinged this often, so a dead peer is noticed before the next round uses it
+    constexpr int kKeepaliveMillis = 10000;
+    constexpr int kKeepaliveTimeoutMillis = 5000;
+    constexpr int kMinReconnectMillis = 250;
+    constexpr int kMaxReconnectMillis = 30000;
+
+    grpc::ChannelArguments channelArguments() {
+        grpc::ChannelArguments args;
+        args.SetInt(GRPC_ARG_KEEPALIVE_TIME_MS, kKeepaliveMillis);
+        args.SetInt(GRPC_ARG_KEEPALIVE_TIMEOUT_MS, kKeepaliveTimeoutMillis);
+        args.SetInt(GRPC_ARG_KEEPALIVE_PERMIT_WITHOUT_CALLS, 1);
+        args.SetInt(GRPC_ARG_HTTP2_MAX_PINGS_WITHOUT_DATA, 0);
+        args.SetInt(GRPC_ARG_INITIAL_RECONNECT_BACKOFF_MS, kMinReconnectMillis);
+        args.SetInt(GRPC_ARG_MIN_RECONNECT_BACKOFF_MS, kMinReconnectMillis);
+        args.SetInt(GRPC_ARG_MAX_RECONNECT_BACKOFF_MS, kMaxReconnectMillis);
+        return args;
+    }
+}
+
+PeerConnections::PeerConnections(const std::vector<std::string>& addresses) {
+    auto args = channelArguments();
+    for (const auto& address : addresses) {
+        auto peer = std::make_unique<Peer>();
+        peer->address = address;
+        peer->channel = grpc::CreateCustomChannel(address, grpc::InsecureChannelCredentials(), args);
+        peer->stub = lseqdb::LSeqDatabase::NewStub(peer->channel);
+        peers.push_back(std::move(peer));
+    }
+}
+
+PeerConnections::Health PeerConnections::health(size_t peer) const {
+    if (peers[peer]->channel->GetState(false) == GRPC_CHANNEL_TRANSIENT_FAILURE) {
+        return Health::FAILING;
+    }
+    return peers[peer]->health.load();
+}
+
+void PeerConnections::reportSuccess(size_t peer) {
+    if (peers[peer]->health.exchange(Health::HEALTHY) == Health::FAILING) {
+        std::cout << "Peer " << peers[peer]->address << " is reachable again" << std::endl;
+    }
+}
+
+void PeerConnections::reportFailure(size_t peer) {
+    if (peers[peer]->health.exchange(Health::FAILING) != Health::FAILING) {
+        std::cerr << "Peer " << peers[peer]->address << " is unreachable" << std::endl;
+    }
+}
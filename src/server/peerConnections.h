@@ -0,0 +1,58 @@
+#pragma once
+
+#include <grpcpp/channel.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "src/proto-src/lseqDb.grpc.pb.h"
+
+// Long-lived channel and stub to every peer of ReplicaList, shared by all replication code.
+// A channel keeps its connection between rounds, pings it while idle and reconnects with
+// backoff on its own, so a round only pays for connection setup after the peer went away
+class PeerConnections {
+public:
+    enum class Health {
+        //Nothing was sent to the peer yet
+        UNKNOWN,
+        HEALTHY,
+        //The last call to the peer failed
+        FAILING,
+    };
+
+    explicit PeerConnections(const std::vector<std::string>& addresses);
+
+    PeerConnections(const PeerConnections&) = delete;
+
+    size_t size() const {
+        return peers.size();
+    }
+
+    const std::string& address(size_t peer) const {
+        return peers[peer]->address;
+    }
+
+    //Stubs are thread safe, every caller may use the same one at a time
+    lseqdb::LSeqDatabase::Stub& stub(size_t peer) const {
+        return *peers[peer]->stub;
+    }
+
+    //Failing as well while the channel waits to reconnect, since calls would fail at once
+    Health health(size_t peer) const;
+
+    //Outcome of a call to the peer, a change of health is logged
+    void reportSuccess(size_t peer);
+    void reportFailure(size_t peer);
+
+private:
+    struct Peer {
+        std::string address;
+        std::shared_ptr<grpc::Channel> channel;
+        std::unique_ptr<lseqdb::LSeqDatabase::Stub> stub;
+        std::atomic<Health> health{Health::UNKNOWN};
+    };
+
+    std::vector<std::unique_ptr<Peer>> peers;
+};
@@ -0,0 +1,250 @@
+#include "replicator.h"
+
+#include <grpcpp/client_context.h>
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <numeric>
+
+#include "src/proto-src/lseqDb.grpc.pb.h"
+#include "src/proto-src/lseqDb.pb.h"
+
+using namespace std::chrono_literals;
+
+using lseqdb::LSeqDatabase;
+
+using grpc::ClientContext;
+using grpc::ClientReaderWriter;
+using grpc::Status;
+
+using lseqdb::DBItems;
+using lseqdb::SeqVector;
+using lseqdb::SyncAck;
+
+namespace {
+    //Seq exchange is a single small message, a peer slower than this is treated as failed
+    constexpr auto kSeqExchangeTimeout = 5s;
+    //Size of one replication chunk
+    constexpr size_t kChunkBytes = 1 << 20;
+    //Replication chunks sent ahead of the peer's acknowledgements
+    constexpr size_t kSyncWindow = 4;
+    //One replication stream runs at most this long, a longer transfer goes on in a new stream
+    constexpr auto kSyncStreamTimeout = 30s;
+    //Streams in a row that end without any acknowledged chunk before a replica is left for this round
+    constexpr int kSyncAttempts = 3;
+    //Least time between the starts of two rounds of a peer, writes within it share a round
+    constexpr std::chrono::milliseconds kMinSyncInterval = 20ms;
+    //Round of a peer that saw no writes for this long
+    constexpr std::chrono::milliseconds kIdleHeartbeat = 10s;
+    constexpr std::chrono::milliseconds kMinBackoff = 250ms;
+    constexpr std::chrono::milliseconds kMaxBackoff = 30s;
+
+    //Seq of every replica the peer has, zero where it has no data. Only replicas with local data are asked for
+    Status ExchangeSeqs(LSeqDatabase::Stub& client, dbConnector* database, size_t maxReplicaId,
+                        std::vector<leveldb::SequenceNumber>& remote) {
+        ClientContext context;
+        context.set_deadline(std::chrono::system_clock::now() + kSeqExchangeTimeout);
+        SeqVector request;
+        SeqVector response;
+        for (size_t id = 0; id < maxReplicaId; ++id) {
+            auto seq = database->sequenceNumberForReplica(id);
+            if (seq > 0) {
+                auto* entry = request.add_entries();
+                entry->set_replica_id(static_cast<int32_t>(id));
+                entry->set_seq(seq);
+            }
+        }
+        remote.assign(maxReplicaId, 0);
+        if (request.entries_size() == 0) {
+            return Status::OK;
+        }
+        Status status = client.SyncSeqs_(&context, request, &response);
+        if (!status.ok()) {
+            return status;
+        }
+        for (const auto& entry : response.entries()) {
+            if (entry.replica_id() < 0 || static_cast<size_t>(entry.replica_id()) >= maxReplicaId) {
+                return {grpc::StatusCode::INTERNAL, "peer returned unknown replica id"};
+            }
+            remote[entry.replica_id()] = entry.seq();
+        }
+        return Status::OK;
+    }
+
+    //Next chunk of the cursor, empty once it is exhausted or failed
+    DBItems DumpBatch(dbConnector::EventCursor& cursor) {
+        batchValues chunk;
+        cursor.next(chunk, std::numeric_limits<size_t>::max(), kChunkBytes);
+        if (!cursor.status().ok()) {
+            return {};
+        }
+        DBItems batch;
+        for (const auto& item : chunk) {
+            auto proto_item = batch.add_items();
+            proto_item->set_lseq(item.lseq);
+            proto_item->set_key(item.key);
+            proto_item->set_value(item.value);
+        }
+        return batch;
+    }
+
+    //Streams the log of replica id after acked to the peer, at most kSyncWindow chunks ahead of its acknowledgements.
+    //Acked is moved to the last chunk the peer applied, so a failed stream is resumed from there
+    Status SendLog(LSeqDatabase::Stub& client, dbConnector* database, size_t id, std::string& acked) {
+        ClientContext context;
+        context.set_deadline(std::chrono::system_clock::now() + kSyncStreamTimeout);
+        std::unique_ptr<ClientReaderWriter<DBItems, SyncAck>> stream(client.SyncStream(&context));
+        auto cursor = database->logCursor(acked, dbConnector::LSEQ_COMPARE::GREATER);
+        size_t inFlight = 0;
+        SyncAck ack;
+        auto readAck = [&]() {
+            if (!stream->Read(&ack)) {
+                return false;
+            }
+            if (!ack.applied_lseq().empty()) {
+                acked = ack.applied_lseq();
+            }
+            --inFlight;
+            return true;
+        };
+        bool open = true;
+        for (auto batch = DumpBatch(*cursor); open && batch.items_size() > 0; batch = DumpBatch(*cursor)) {
+            batch.set_replica_id(static_cast<int32_t>(id));
+            open = (inFlight < kSyncWindow || readAck()) && stream->Write(batch);
+            inFlight += open ? 1 : 0;
+        }
+        if (open) {
+            stream->WritesDone();
+        }
+        while (inFlight > 0 && readAck()) {}
+        Status status = stream->Finish();
+        if (status.ok() && !cursor->status().ok()) {
+            return {grpc::StatusCode::UNAVAILABLE, cursor->status().ToString()};
+        }
+        return status;
+    }
+}
+
+Replicator::Replicator(const YAMLConfig& config, dbConnector* database, PeerConnections* connections)
+        : database(database), connections(connections) {
+    std::random_device rd;
+    for (size_t i = 0; i < connections->size(); ++i) {
+        auto peer = std::make_unique<Peer>();
+        peer->index = i;
+        peer->syncOrder.resize(config.getMaxReplicaId());
+        std::iota(peer->syncOrder.begin(), peer->syncOrder.end(), static_cast<size_t>(0));
+        peer->rnd.seed(rd());
+        peers.push_back(std::move(peer));
+    }
+    for (auto& peer : peers) {
+        peer->worker = std::thread(&Replicator::runPeer, this, std::ref(*peer));
+    }
+    database->setWriteListener([this] { notifyWrite(); });
+}
+
+Replicator::~Replicator() {
+    database->setWriteListener({});
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    stopped.notify_all();
+    for (auto& peer : peers) {
+        peer->worker.join();
+    }
+}
+
+void Replicator::notifyWrite() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto& peer : peers) {
+            peer->pending = true;
+        }
+    }
+    stopped.notify_all();
+}
+
+void Replicator::runPeer(Peer& peer) {
+    //Data written before start is sent at once
+    auto earliest = std::chrono::steady_clock::now();
+    bool retry = true;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            //Writes during the minimum interval or a backoff only mark the peer pending
+            if (stopped.wait_until(lock, earliest, [this] { return stop; }))
+                return;
+            auto heartbeat = earliest + (retry ? 0ms : kIdleHeartbeat);
+            stopped.wait_until(lock, heartbeat, [&] { return stop || peer.pending; });
+            if (stop)
+                return;
+            //Cleared before the round, so a write it might miss starts the next one
+            peer.pending = false;
+        }
+        auto start = std::chrono::steady_clock::now();
+        if (syncPeer(peer)) {
+            connections->reportSuccess(peer.index);
+            peer.backoff = 0ms;
+            earliest = start + kMinSyncInterval;
+            retry = false;
+        } else {
+            connections->reportFailure(peer.index);
+            peer.backoff = std::clamp(peer.backoff * 2, kMinBackoff, kMaxBackoff);
+            earliest = start + peer.backoff;
+            retry = true;
+        }
+    }
+}
+
+bool Replicator::syncPeer(Peer& peer) {
+    //Channel of the peer stays connected between rounds
+    auto& client = connections->stub(peer.index);
+    const auto& address = connections->address(peer.index);
+
+    //One round trip tells every range the peer is missing
+    std::vector<leveldb::SequenceNumber> remoteSeqs;
+    Status exchange = ExchangeSeqs(client, database, peer.syncOrder.size(), remoteSeqs);
+    if (!exchange.ok()) {
+        std::cerr << "Failed to get seqs from " << address << ": " << exchange.error_message() << std::endl;
+        return false;
+    }
+
+    // Shuffle replicas for sync to reduce per-node load
+    std::shuffle(peer.syncOrder.begin(), peer.syncOrder.end(), peer.rnd);
+
+    bool synced = true;
+    // iterate over known replicas in random order
+    for (auto id : peer.syncOrder) {
+        auto maxSeq = database->sequenceNumberForReplica(id);
+        auto remoteSeq = remoteSeqs[id];
+        if (maxSeq <= remoteSeq) {
+            // No new data
+            continue;
+        } else {
+            std::cout << "Trying to sync data from " << id << " with " << address << "\n";
+            std::cout << "Current localMaxSeq(" << id << ")=" << maxSeq << "; "
+                      << "remoteMaxSeq(" << address << ", " << id << ")=" << remoteSeq << std::endl;
+        }
+
+        //Sent in chunks, so a replica far behind never makes this node hold the whole log.
+        //Every stream goes on from the last chunk the peer applied
+        std::string acked = dbConnector::generateLseqKey(remoteSeq, id);
+        Status status;
+        for (int failures = 0; failures < kSyncAttempts;) {
+            std::string before = acked;
+            status = SendLog(client, database, id, acked);
+            if (status.ok()) {
+                break;
+            }
+            std::cerr << "Failed to send batch to " << address << ": " << status.error_message() << std::endl;
+            failures = acked == before ? failures + 1 : 0;
+        }
+        if (status.ok()) {
+            std::cout << "Data has been successfully synchronized" << std::endl;
+        } else {
+            synced = false;
+        }
+    }
+    return synced;
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "src/db/dbConnector.hpp"
+#include "src/server/peerConnections.h"
+#include "src/utils/yamlConfig.hpp"
+
+// Pushes the log of every replica to each peer of connections. Every peer has its own worker thread,
+// so a slow or unreachable peer only delays itself. A round starts as soon as the database reports a write,
+// writes arriving meanwhile are merged into the next round. An idle peer still gets a round every heartbeat,
+// which covers anything the signal missed. A peer whose round failed is retried with exponential backoff
+class Replicator {
+public:
+    //Workers start at once and run until the replicator is destroyed
+    Replicator(const YAMLConfig& config, dbConnector* database, PeerConnections* connections);
+
+    Replicator(const Replicator&) = delete;
+
+    //Waits for rounds in progress
+    ~Replicator();
+
+    //Wakes every worker for a round, called by the database after each write
+    void notifyWrite();
+
+private:
+    struct Peer {
+        //Index in connections
+        size_t index;
+        //Replica ids in the order this peer is synced, shuffled every round
+        std::vector<size_t> syncOrder;
+        std::mt19937 rnd;
+        std::chrono::milliseconds backoff{0};
+        //A write arrived since the last round started, guarded by mutex
+        bool pending = false;
+        std::thread worker;
+    };
+
+    void runPeer(Peer& peer);
+
+    //One round over every replica id, false if any of them failed
+    bool syncPeer(Peer& peer);
+
+    dbConnector* database;
+    PeerConnections* connections;
+    std::vector<std::unique_ptr<Peer>> peers;
+    std::mutex mutex;
+    std::condition_variable stopped;
+    bool stop = false;
+};
@@ -9,4 +9,33 @@ namespace ConfigConstant {
     static const std::string REPLICA_LIST("ReplicaList");
     static const std::string DB_FILENAME("DbFilename");
     static const std::string SELF_PORT("Port");
+    static const std::string STORAGE_VALUE_NAME("Storage");
+    static const std::string BLOOM_BITS_PER_KEY("BloomBitsPerKey");
+    static const std::string SPLIT_NAMESPACES("SplitNamespaces");
+    static const std::string BLOCK_CACHE_SIZE("BlockCacheSize");
+    static const std::string VALUES_NAMESPACE("Values");
+    static const std::string GETSEQ_NAMESPACE("Getseq");
+    static const std::string LSEQ_NAMESPACE("Lseq");
+    static const std::string HISTORY_NAMESPACE("History");
+    static const std::string BLOCK_SIZE("BlockSize");
+    static const std::string WRITE_BUFFER_SIZE("WriteBufferSize");
+    static const std::string CACHE_SHARE("CacheShare");
+    static const std::string GROUP_COMMIT_WINDOW_MICROS("GroupCommitWindowMicros");
+    static const std::string GROUP_COMMIT_MAX_BYTES("GroupCommitMaxBytes");
+    static const std::string DURABILITY("Durability");
+    static const std::string SYNC_INTERVAL_MILLIS("SyncIntervalMillis");
+    static const std::string SYNC_BYTES("SyncBytes");
+    static const std::string VALUE_CACHE_SIZE("ValueCacheSize");
+    static const std::string PRESET("Preset");
+    static const std::string MAX_OPEN_FILES("MaxOpenFiles");
+    static const std::string BLOCK_RESTART_INTERVAL("BlockRestartInterval");
+    static const std::string MAX_FILE_SIZE("MaxFileSize");
+    static const std::string COMPRESSION("Compression");
+    static const std::string RETAIN_VERSIONS("RetainVersions");
+    static const std::string RETAIN_SECONDS("RetainSeconds");
+    static const std::string GC_CHUNK_RECORDS("GcChunkRecords");
+    static const std::string GC_PAUSE_MILLIS("GcPauseMillis");
+    static const std::string GC_INTERVAL_SECONDS("GcIntervalSeconds");
+    static const std::string WARMUP_KEYS("WarmupKeys");
+    static const std::string WARMUP_INTERVAL_SECONDS("WarmupIntervalSeconds");
 }
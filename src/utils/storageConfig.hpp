@@ -0,0 +1,299 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "configVars.hpp"
+#include "yaml-cpp/yaml.h"
+
+//When a write is acknowledged: after it is applied (none), after a background sync of the log
+//which runs every sync interval or sync bytes (periodic), or after its own synced write (always)
+enum class Durability { NONE, PERIODIC, ALWAYS };
+
+enum class Compression { NONE, SNAPPY };
+
+//LevelDB tuning of one key namespace. cacheShare is the part of the block cache it gets when namespaces are split
+struct NamespaceTuning {
+public:
+    size_t blockSize;
+    size_t writeBufferSize;
+    double cacheShare;
+};
+
+//Optional section, every field falls back to its default when absent
+struct StorageConfig {
+public:
+    //0 disables the bloom filter
+    int bloomBitsPerKey = 10;
+    //Keep latest values, getseq index, lseq log and history in separate databases.
+    //Can only be chosen when the database is created
+    bool splitNamespaces = false;
+    //0 leaves every database with the LevelDB internal cache
+    size_t blockCacheSize = 8 * 1024 * 1024;
+    //Without split values tuning applies to the single database, which gets the whole cache
+    NamespaceTuning values{4 * 1024, 4 * 1024 * 1024, 0.5};
+    NamespaceTuning getseq{4 * 1024, 2 * 1024 * 1024, 0.3};
+    NamespaceTuning lseq{4 * 1024, 2 * 1024 * 1024, 0.05};
+    NamespaceTuning history{16 * 1024, 8 * 1024 * 1024, 0.15};
+    //How long the group commit stage waits for more writes before committing what is queued, 0 commits at once
+    int groupCommitWindowMicros = 0;
+    //Keys and values of one group commit; a single larger write still goes alone
+    size_t groupCommitMaxBytes = 1024 * 1024;
+    //Default for writes which do not choose durability themselves
+    Durability durability = Durability::NONE;
+    int syncIntervalMillis = 10;
+    size_t syncBytes = 1024 * 1024;
+    //Latest values kept in memory for get, 0 disables it
+    size_t valueCacheSize = 8 * 1024 * 1024;
+    //Applied to every database. LevelDB needs some files for itself, so fewer than 74 are refused
+    int maxOpenFiles = 1000;
+    int blockRestartInterval = 16;
+    //Table files LevelDB aims for, from 1 MiB to 1 GiB
+    size_t maxFileSize = 2 * 1024 * 1024;
+    Compression compression = Compression::SNAPPY;
+    //Retention of history versions, per key and replica. A version is collected once it is neither among
+    //the newest retainVersions nor younger than retainSeconds; 0 turns a limit off, both 0 keep everything.
+    //The newest version is always kept
+    size_t retainVersions = 0;
+    int64_t retainSeconds = 0;
+    //Collector reads this many history records, deletes what expired among them and pauses before the next chunk
+    size_t gcChunkRecords = 10000;
+    int gcPauseMillis = 50;
+    int gcIntervalSeconds = 60;
+    //Hot keys saved next to the database every warmup interval and on close, and read back in the background
+    //after the next start to warm up the block and value caches. 0 turns it off
+    size_t warmupKeys = 4096;
+    int warmupIntervalSeconds = 300;
+
+    //Named starting points, fields given next to the preset override it. False for an unknown name
+    static bool preset(const std::string& name, StorageConfig& config) {
+        config = StorageConfig();
+        if (name == "write-heavy") {
+            //Bigger memtables and files mean fewer, larger compactions; writes are grouped more eagerly
+            config.values.writeBufferSize = 16 * 1024 * 1024;
+            config.getseq.writeBufferSize = 8 * 1024 * 1024;
+            config.lseq.writeBufferSize = 8 * 1024 * 1024;
+            config.history.writeBufferSize = 32 * 1024 * 1024;
+            config.maxFileSize = 8 * 1024 * 1024;
+            config.groupCommitWindowMicros = 200;
+            config.groupCommitMaxBytes = 4 * 1024 * 1024;
+        } else if (name == "read-heavy") {
+            config.bloomBitsPerKey = 12;
+            config.blockCacheSize = 64 * 1024 * 1024;
+            config.valueCacheSize = 64 * 1024 * 1024;
+            config.maxOpenFiles = 4000;
+        } else if (name == "low-memory") {
+            config.blockCacheSize = 1024 * 1024;
+            config.valueCacheSize = 512 * 1024;
+            config.values.writeBufferSize = 1024 * 1024;
+            config.getseq.writeBufferSize = 512 * 1024;
+            config.lseq.writeBufferSize = 512 * 1024;
+            config.history.writeBufferSize = 1024 * 1024;
+            config.maxOpenFiles = 100;
+            config.warmupKeys = 1024;
+            config.groupCommitMaxBytes = 256 * 1024;
+        } else {
+            return false;
+        }
+        return true;
+    }
+};
+
+namespace YAML {
+    template<>
+    struct convert<Durability> {
+        static Node encode(const Durability& rhs) {
+            switch (rhs) {
+                case Durability::PERIODIC:
+                    return Node("periodic");
+                case Durability::ALWAYS:
+                    return Node("always");
+                default:
+                    return Node("none");
+            }
+        }
+
+        static bool decode(const Node& node, Durability& rhs) {
+            auto name = node.as<std::string>();
+            if (name == "none") {
+                rhs = Durability::NONE;
+            } else if (name == "periodic") {
+                rhs = Durability::PERIODIC;
+            } else if (name == "always") {
+                rhs = Durability::ALWAYS;
+            } else {
+                return false;
+            }
+            return true;
+        }
+    };
+
+    template<>
+    struct convert<Compression> {
+        static Node encode(const Compression& rhs) {
+            return Node(rhs == Compression::SNAPPY ? "snappy" : "none");
+        }
+
+        static bool decode(const Node& node, Compression& rhs) {
+            auto name = node.as<std::string>();
+            if (name == "none") {
+                rhs = Compression::NONE;
+            } else if (name == "snappy") {
+                rhs = Compression::SNAPPY;
+            } else {
+                return false;
+            }
+            return true;
+        }
+    };
+
+    template<>
+    struct convert<NamespaceTuning> {
+        static Node encode(const NamespaceTuning& rhs) {
+            Node node;
+            node[ConfigConstant::BLOCK_SIZE] = rhs.blockSize;
+            node[ConfigConstant::WRITE_BUFFER_SIZE] = rhs.writeBufferSize;
+            node[ConfigConstant::CACHE_SHARE] = rhs.cacheShare;
+            return node;
+        }
+
+        //Fields absent in node keep their current values
+        static bool decode(const Node& node, NamespaceTuning& rhs) {
+            if (node[ConfigConstant::BLOCK_SIZE]) {
+                rhs.blockSize = node[ConfigConstant::BLOCK_SIZE].as<size_t>();
+            }
+            if (node[ConfigConstant::WRITE_BUFFER_SIZE]) {
+                rhs.writeBufferSize = node[ConfigConstant::WRITE_BUFFER_SIZE].as<size_t>();
+            }
+            if (node[ConfigConstant::CACHE_SHARE]) {
+                rhs.cacheShare = node[ConfigConstant::CACHE_SHARE].as<double>();
+            }
+            //LevelDB would silently raise a smaller write buffer to 64 KiB
+            return rhs.blockSize > 0 && rhs.writeBufferSize >= 64 * 1024 && rhs.cacheShare >= 0;
+        }
+    };
+
+    template<>
+    struct convert<StorageConfig> {
+        static Node encode(const StorageConfig& rhs) {
+            Node node;
+            node[ConfigConstant::BLOOM_BITS_PER_KEY] = rhs.bloomBitsPerKey;
+            node[ConfigConstant::SPLIT_NAMESPACES] = rhs.splitNamespaces;
+            node[ConfigConstant::BLOCK_CACHE_SIZE] = rhs.blockCacheSize;
+            node[ConfigConstant::VALUES_NAMESPACE] = rhs.values;
+            node[ConfigConstant::GETSEQ_NAMESPACE] = rhs.getseq;
+            node[ConfigConstant::LSEQ_NAMESPACE] = rhs.lseq;
+            node[ConfigConstant::HISTORY_NAMESPACE] = rhs.history;
+            node[ConfigConstant::GROUP_COMMIT_WINDOW_MICROS] = rhs.groupCommitWindowMicros;
+            node[ConfigConstant::GROUP_COMMIT_MAX_BYTES] = rhs.groupCommitMaxBytes;
+            node[ConfigConstant::DURABILITY] = rhs.durability;
+            node[ConfigConstant::SYNC_INTERVAL_MILLIS] = rhs.syncIntervalMillis;
+            node[ConfigConstant::SYNC_BYTES] = rhs.syncBytes;
+            node[ConfigConstant::VALUE_CACHE_SIZE] = rhs.valueCacheSize;
+            node[ConfigConstant::MAX_OPEN_FILES] = rhs.maxOpenFiles;
+            node[ConfigConstant::BLOCK_RESTART_INTERVAL] = rhs.blockRestartInterval;
+            node[ConfigConstant::MAX_FILE_SIZE] = rhs.maxFileSize;
+            node[ConfigConstant::COMPRESSION] = rhs.compression;
+            node[ConfigConstant::RETAIN_VERSIONS] = rhs.retainVersions;
+            node[ConfigConstant::RETAIN_SECONDS] = rhs.retainSeconds;
+            node[ConfigConstant::GC_CHUNK_RECORDS] = rhs.gcChunkRecords;
+            node[ConfigConstant::GC_PAUSE_MILLIS] = rhs.gcPauseMillis;
+            node[ConfigConstant::GC_INTERVAL_SECONDS] = rhs.gcIntervalSeconds;
+            node[ConfigConstant::WARMUP_KEYS] = rhs.warmupKeys;
+            node[ConfigConstant::WARMUP_INTERVAL_SECONDS] = rhs.warmupIntervalSeconds;
+            return node;
+        }
+
+        static bool decode(const Node& node, StorageConfig& rhs) {
+            if (node[ConfigConstant::PRESET] && !StorageConfig::preset(node[ConfigConstant::PRESET].as<std::string>(), rhs)) {
+                return false;
+            }
+            if (node[ConfigConstant::BLOOM_BITS_PER_KEY]) {
+                rhs.bloomBitsPerKey = node[ConfigConstant::BLOOM_BITS_PER_KEY].as<int>();
+            }
+            if (node[ConfigConstant::SPLIT_NAMESPACES]) {
+                rhs.splitNamespaces = node[ConfigConstant::SPLIT_NAMESPACES].as<bool>();
+            }
+            if (node[ConfigConstant::BLOCK_CACHE_SIZE]) {
+                rhs.blockCacheSize = node[ConfigConstant::BLOCK_CACHE_SIZE].as<size_t>();
+            }
+            if (node[ConfigConstant::GROUP_COMMIT_WINDOW_MICROS]) {
+                rhs.groupCommitWindowMicros = node[ConfigConstant::GROUP_COMMIT_WINDOW_MICROS].as<int>();
+            }
+            if (node[ConfigConstant::GROUP_COMMIT_MAX_BYTES]) {
+                rhs.groupCommitMaxBytes = node[ConfigConstant::GROUP_COMMIT_MAX_BYTES].as<size_t>();
+            }
+            if (node[ConfigConstant::DURABILITY]) {
+                rhs.durability = node[ConfigConstant::DURABILITY].as<Durability>();
+            }
+            if (node[ConfigConstant::SYNC_INTERVAL_MILLIS]) {
+                rhs.syncIntervalMillis = node[ConfigConstant::SYNC_INTERVAL_MILLIS].as<int>();
+            }
+            if (node[ConfigConstant::SYNC_BYTES]) {
+                rhs.syncBytes = node[ConfigConstant::SYNC_BYTES].as<size_t>();
+            }
+            if (node[ConfigConstant::VALUE_CACHE_SIZE]) {
+                rhs.valueCacheSize = node[ConfigConstant::VALUE_CACHE_SIZE].as<size_t>();
+            }
+            if (node[ConfigConstant::MAX_OPEN_FILES]) {
+                rhs.maxOpenFiles = node[ConfigConstant::MAX_OPEN_FILES].as<int>();
+            }
+            if (node[ConfigConstant::BLOCK_RESTART_INTERVAL]) {
+                rhs.blockRestartInterval = node[ConfigConstant::BLOCK_RESTART_INTERVAL].as<int>();
+            }
+            if (node[ConfigConstant::MAX_FILE_SIZE]) {
+                rhs.maxFileSize = node[ConfigConstant::MAX_FILE_SIZE].as<size_t>();
+            }
+            if (node[ConfigConstant::COMPRESSION]) {
+                rhs.compression = node[ConfigConstant::COMPRESSION].as<Compression>();
+            }
+            if (node[ConfigConstant::RETAIN_VERSIONS]) {
+                rhs.retainVersions = node[ConfigConstant::RETAIN_VERSIONS].as<size_t>();
+            }
+            if (node[ConfigConstant::RETAIN_SECONDS]) {
+                rhs.retainSeconds = node[ConfigConstant::RETAIN_SECONDS].as<int64_t>();
+            }
+            if (node[ConfigConstant::GC_CHUNK_RECORDS]) {
+                rhs.gcChunkRecords = node[ConfigConstant::GC_CHUNK_RECORDS].as<size_t>();
+            }
+            if (node[ConfigConstant::GC_PAUSE_MILLIS]) {
+                rhs.gcPauseMillis = node[ConfigConstant::GC_PAUSE_MILLIS].as<int>();
+            }
+            if (node[ConfigConstant::GC_INTERVAL_SECONDS]) {
+                rhs.gcIntervalSeconds = node[ConfigConstant::GC_INTERVAL_SECONDS].as<int>();
+            }
+            if (node[ConfigConstant::WARMUP_KEYS]) {
+                rhs.warmupKeys = node[ConfigConstant::WARMUP_KEYS].as<size_t>();
+            }
+            if (node[ConfigConstant::WARMUP_INTERVAL_SECONDS]) {
+                rhs.warmupIntervalSeconds = node[ConfigConstant::WARMUP_INTERVAL_SECONDS].as<int>();
+            }
+            //Decoded in place, so that a partially specified namespace keeps the rest of its defaults
+            const std::pair<const std::string&, NamespaceTuning&> namespaces[] = {
+                {ConfigConstant::VALUES_NAMESPACE, rhs.values},
+                {ConfigConstant::GETSEQ_NAMESPACE, rhs.getseq},
+                {ConfigConstant::LSEQ_NAMESPACE, rhs.lseq},
+                {ConfigConstant::HISTORY_NAMESPACE, rhs.history},
+            };
+            for (const auto& [name, tuning] : namespaces) {
+                if (node[name] && !convert<NamespaceTuning>::decode(node[name], tuning)) {
+                    return false;
+                }
+                //Only the values database exists without split, tuning of another namespace would be ignored
+                if (node[name] && !rhs.splitNamespaces && &tuning != &rhs.values) {
+                    return false;
+                }
+            }
+            double totalShare = rhs.values.cacheShare + rhs.getseq.cacheShare + rhs.lseq.cacheShare + rhs.history.cacheShare;
+            return rhs.bloomBitsPerKey >= 0 && totalShare <= 1.0 + 1e-9 &&
+                   rhs.groupCommitWindowMicros >= 0 && rhs.groupCommitMaxBytes > 0 &&
+                   rhs.syncIntervalMillis > 0 && rhs.syncBytes > 0 &&
+                   rhs.maxOpenFiles >= 74 && rhs.blockRestartInterval > 0 &&
+                   rhs.maxFileSize >= 1024 * 1024 && rhs.maxFileSize <= 1024 * 1024 * 1024 &&
+                   rhs.retainSeconds >= 0 && rhs.gcChunkRecords > 0 && rhs.gcPauseMillis >= 0 && rhs.gcIntervalSeconds > 0 &&
+                   rhs.warmupIntervalSeconds > 0;
+        }
+    };
+}
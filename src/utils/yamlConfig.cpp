@@ -8,6 +8,9 @@
 YAMLConfig::YAMLConfig(std::string s) {
     auto value = YAML::LoadFile(s);
     grpcConfig = value[ConfigConstant::GRPC_VALUE_NAME].as<GRPCConfig>();
+    if (value[ConfigConstant::STORAGE_VALUE_NAME]) {
+        storageConfig = value[ConfigConstant::STORAGE_VALUE_NAME].as<StorageConfig>();
+    }
     //maybe assert id value
     id = value[ConfigConstant::ID].as<int>();
     maxReplicaId = value[ConfigConstant::MAX_REPLICA_ID].as<int>() + 1;
@@ -44,3 +47,7 @@ void YAMLConfig::addReplica(std::string newReplica) {
 const GRPCConfig& YAMLConfig::getGRPCConfig() const {
     return grpcConfig;
 }
+
+const StorageConfig& YAMLConfig::getStorageConfig() const {
+    return storageConfig;
+}
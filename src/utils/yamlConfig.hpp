@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "grpcConfig.hpp"
+#include "storageConfig.hpp"
 
 class YAMLConfig {
 public:
@@ -17,12 +18,15 @@ public:
 
     [[nodiscard]] const GRPCConfig& getGRPCConfig() const;
 
+    [[nodiscard]] const StorageConfig& getStorageConfig() const;
+
     [[nodiscard]] int getMaxReplicaId() const;
 
     void addReplica(std::string newReplica);
 
 private:
     GRPCConfig grpcConfig;
+    StorageConfig storageConfig;
     std::string dbFilename;
     std::vector<std::string> replicas;
     int id;
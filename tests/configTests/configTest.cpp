@@ -17,4 +17,60 @@ TEST(configTest, GeneralConfig) {
 TEST(configTest, GRPCConfig) {
     YAMLConfig config("resources/config.yaml");
     EXPECT_EQ(config.getGRPCConfig().port, 8888);
-}
\ No newline at end of file
+}
+
+TEST(configTest, StorageConfig) {
+    YAMLConfig config("resources/config.yaml");
+    EXPECT_EQ(config.getStorageConfig().bloomBitsPerKey, 12);
+    EXPECT_EQ(config.getStorageConfig().groupCommitWindowMicros, 100);
+    EXPECT_EQ(config.getStorageConfig().durability, Durability::NONE);
+    EXPECT_EQ(config.getStorageConfig().groupCommitMaxBytes, StorageConfig().groupCommitMaxBytes);
+    EXPECT_EQ(config.getStorageConfig().valueCacheSize, StorageConfig().valueCacheSize);
+}
+
+TEST(configTest, StorageNamespaces) {
+    YAMLConfig config("resources/splitConfig.yaml");
+    const StorageConfig& storage = config.getStorageConfig();
+    EXPECT_TRUE(storage.splitNamespaces);
+    EXPECT_EQ(storage.durability, Durability::PERIODIC);
+    EXPECT_EQ(storage.syncIntervalMillis, 5);
+    EXPECT_EQ(storage.syncBytes, StorageConfig().syncBytes);
+    EXPECT_EQ(storage.blockCacheSize, 16777216);
+    EXPECT_EQ(storage.valueCacheSize, 1048576);
+    EXPECT_EQ(storage.values.writeBufferSize, 1048576);
+    EXPECT_DOUBLE_EQ(storage.values.cacheShare, 0.4);
+    EXPECT_EQ(storage.values.blockSize, StorageConfig().values.blockSize);
+    EXPECT_EQ(storage.lseq.blockSize, 8192);
+    EXPECT_EQ(storage.bloomBitsPerKey, StorageConfig().bloomBitsPerKey);
+}
+
+TEST(configTest, StoragePresets) {
+    auto storage = YAML::Load("{Preset: read-heavy, ValueCacheSize: 1024, Compression: none}").as<StorageConfig>();
+    EXPECT_EQ(storage.blockCacheSize, 64 * 1024 * 1024);
+    EXPECT_EQ(storage.maxOpenFiles, 4000);
+    EXPECT_EQ(storage.valueCacheSize, 1024);
+    EXPECT_EQ(storage.compression, Compression::NONE);
+
+    storage = YAML::Load("{Preset: write-heavy, Values: {BlockSize: 8192}}").as<StorageConfig>();
+    EXPECT_EQ(storage.values.writeBufferSize, 16 * 1024 * 1024);
+    EXPECT_EQ(storage.values.blockSize, 8192);
+    EXPECT_EQ(storage.maxFileSize, 8 * 1024 * 1024);
+
+    storage = YAML::Load("{Preset: low-memory}").as<StorageConfig>();
+    EXPECT_EQ(storage.blockCacheSize, 1024 * 1024);
+    EXPECT_EQ(storage.maxOpenFiles, 100);
+}
+
+TEST(configTest, StorageRejectsInvalid) {
+    EXPECT_THROW(YAML::Load("{Preset: unknown}").as<StorageConfig>(), YAML::Exception);
+    EXPECT_THROW(YAML::Load("{MaxOpenFiles: 10}").as<StorageConfig>(), YAML::Exception);
+    EXPECT_THROW(YAML::Load("{MaxFileSize: 1024}").as<StorageConfig>(), YAML::Exception);
+    EXPECT_THROW(YAML::Load("{BlockRestartInterval: 0}").as<StorageConfig>(), YAML::Exception);
+    EXPECT_THROW(YAML::Load("{Compression: zstd}").as<StorageConfig>(), YAML::Exception);
+    EXPECT_THROW(YAML::Load("{Values: {WriteBufferSize: 1024}}").as<StorageConfig>(), YAML::Exception);
+    EXPECT_THROW(YAML::Load("{RetainSeconds: -1}").as<StorageConfig>(), YAML::Exception);
+    EXPECT_THROW(YAML::Load("{GcChunkRecords: 0}").as<StorageConfig>(), YAML::Exception);
+    //Namespace tuning only applies to split databases
+    EXPECT_THROW(YAML::Load("{Getseq: {BlockSize: 8192}}").as<StorageConfig>(), YAML::Exception);
+    EXPECT_NO_THROW(YAML::Load("{SplitNamespaces: true, Getseq: {BlockSize: 8192}}").as<StorageConfig>());
+}
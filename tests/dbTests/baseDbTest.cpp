@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -128,6 +131,91 @@ TEST_F(baseDbTest, multithreadPutsAndGets) {
     }
 }
 
+TEST_F(baseDbTest, durabilityOverride) {
+    std::vector<std::thread> writers;
+    for (Durability durability : {Durability::NONE, Durability::PERIODIC, Durability::ALWAYS}) {
+        writers.emplace_back([this, durability]() {
+            for (int i = 0; i < 20; ++i) {
+                std::string key = "d" + std::to_string(static_cast<int>(durability)) + "_" + std::to_string(i);
+                EXPECT_TRUE(db.put(key, key, durability).response_status.ok());
+            }
+            std::string key = "d" + std::to_string(static_cast<int>(durability)) + "_0";
+            EXPECT_TRUE(db.remove(key, durability).response_status.ok());
+        });
+    }
+    for (auto& thread : writers) {
+        thread.join();
+    }
+    EXPECT_EQ(db.get("d1_19").value, "d1_19");
+    EXPECT_TRUE(db.get("d1_0").response_status.IsNotFound());
+    EXPECT_EQ(db.get("d2_5").value, "d2_5");
+}
+
+TEST_F(baseDbTest, concurrentWritesGetConsecutiveLseqs) {
+    constexpr int kKeyPerThreadCount = 200;
+    constexpr int kThreadCount = 8;
+
+    leveldb::SequenceNumber before = db.sequenceNumberForReplica(2);
+    std::vector<std::vector<std::string>> lseqs(kThreadCount);
+    std::vector<std::thread> writers;
+    for (int i = 0; i < kThreadCount; ++i) {
+        writers.emplace_back([this, i, &lseqs]() {
+            for (int j = 0; j < kKeyPerThreadCount; ++j) {
+                std::string key = "gc" + std::to_string(i) + "_" + std::to_string(j);
+                auto result = (j % 4 == 3) ? db.remove(key) : db.put(key, key);
+                EXPECT_TRUE(result.response_status.ok());
+                lseqs[i].push_back(result.lseq);
+            }
+        });
+    }
+    for (auto& thread : writers) {
+        thread.join();
+    }
+
+    std::vector<leveldb::SequenceNumber> seqs;
+    for (int i = 0; i < kThreadCount; ++i) {
+        //Writes of one thread are committed in call order
+        EXPECT_TRUE(std::is_sorted(lseqs[i].begin(), lseqs[i].end()));
+        for (const auto& lseq : lseqs[i]) {
+            seqs.push_back(dbConnector::lseqToSeq(lseq));
+        }
+    }
+    std::sort(seqs.begin(), seqs.end());
+    ASSERT_EQ(seqs.size(), kThreadCount * kKeyPerThreadCount);
+    EXPECT_GT(seqs.front(), before);
+    for (size_t i = 0; i < seqs.size(); ++i) {
+        EXPECT_EQ(seqs[i], seqs.front() + i);
+    }
+    EXPECT_EQ(db.sequenceNumberForReplica(2), seqs.back());
+    EXPECT_EQ(db.get("gc3_10").value, "gc3_10");
+    EXPECT_EQ(db.get("gc3_10").lseq, lseqs[3][10]);
+}
+
+TEST_F(baseDbTest, getDuringConcurrentPuts) {
+    constexpr int kPutCount = 500;
+    ASSERT_TRUE(db.put("hot", "0").response_status.ok());
+    std::atomic<bool> done = false;
+    std::thread writer([this, &done]() {
+        for (int i = 1; i <= kPutCount; ++i) {
+            EXPECT_TRUE(db.put("hot", std::to_string(i)).response_status.ok());
+        }
+        done = true;
+    });
+
+    while (!done) {
+        auto start = std::chrono::steady_clock::now();
+        pureReplyValue res = db.get("hot");
+        EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(50));
+        ASSERT_TRUE(res.response_status.ok());
+        //Value is the one written with the returned lseq
+        replyBatchFormat versions = db.getByLseq(res.lseq);
+        ASSERT_FALSE(versions.values.empty());
+        EXPECT_EQ(versions.values[0].value, res.value);
+    }
+    writer.join();
+    EXPECT_EQ(db.get("hot").value, std::to_string(kPutCount));
+}
+
 TEST_F(baseDbTest, multithreadRemovalsAndGets) {
     constexpr int kKeyPerThreadCount = 100;
     constexpr int kThreadCount = 8;
@@ -174,3 +262,56 @@ TEST_F(baseDbTest, multithreadRemovalsAndGets) {
         is_expected ^= (true);
     }
 }
+
+TEST_F(baseDbTest, valueCacheFollowsWrites) {
+    int selfId = config.getId();
+    //Warmup reads keys saved by earlier tests, which would be counted too
+    while (!db.warmedUp()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    ValueCache::Stats before = db.valueCacheStats();
+    std::string lseq = db.put("cached", "v1").lseq;
+    //Put fills the cache, so the read never reaches LevelDB
+    EXPECT_EQ(db.get("cached").value, "v1");
+    EXPECT_EQ(db.get("cached").lseq, lseq);
+    EXPECT_EQ(db.valueCacheStats().hits, before.hits + 2);
+
+    EXPECT_EQ(db.get("cached", selfId + 1).response_status.IsNotFound(), true);
+    EXPECT_EQ(db.valueCacheStats().misses, before.misses + 1);
+    EXPECT_TRUE(db.putBatch({
+        {dbConnector::generateLseqKey(5, selfId + 1), dbConnector::generateNormalKey("cached", selfId + 1), "other"}
+    }).ok());
+    EXPECT_EQ(db.get("cached", selfId + 1).value, "other");
+
+    db.put("cached", "v2");
+    EXPECT_EQ(db.get("cached").value, "v2");
+    db.remove("cached");
+    EXPECT_TRUE(db.get("cached").response_status.IsNotFound());
+    EXPECT_EQ(db.get("cached", selfId + 1).value, "other");
+}
+
+TEST_F(baseDbTest, writeListenerSeesWrites) {
+    int selfId = config.getId();
+    std::atomic<int> calls{0};
+    leveldb::SequenceNumber seen = 0;
+    db.setWriteListener([&] {
+        seen = db.sequenceNumberForReplica(selfId);
+        ++calls;
+    });
+    db.put("listened", "v1");
+    EXPECT_EQ(calls, 1);
+    //The write is already counted when the listener runs
+    EXPECT_EQ(seen, db.sequenceNumberForReplica(selfId));
+    db.remove("listened");
+    EXPECT_EQ(calls, 2);
+    EXPECT_TRUE(db.putBatch({
+        {dbConnector::generateLseqKey(7, selfId + 1), dbConnector::generateNormalKey("listened", selfId + 1), "other"}
+    }).ok());
+    EXPECT_EQ(calls, 3);
+    EXPECT_FALSE(db.putBatch({{"malformed", "key", "value"}}).ok());
+    EXPECT_EQ(calls, 3);
+
+    db.setWriteListener({});
+    db.put("listened", "v2");
+    EXPECT_EQ(calls, 3);
+}
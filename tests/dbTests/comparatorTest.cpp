@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "src/db/comparator.hpp"
+#include "leveldb/db.h"
+
+namespace {
+    std::string randomKey(std::mt19937& rnd) {
+        std::uniform_int_distribution<int> length(0, 6);
+        std::uniform_int_distribution<int> byte(0, 3);
+        std::string res(length(rnd), '\0');
+        for (auto& c : res) {
+            //Small alphabet including 0xff to hit carry cases
+            c = static_cast<char>(byte(rnd) == 3 ? 0xff : byte(rnd));
+        }
+        return res;
+    }
+}
+
+TEST(comparatorTest, lengthFirstOrder) {
+    const auto& cmp = leveldb::GLOBAL_COMPARATOR;
+    EXPECT_LT(cmp.Compare("z", "aa"), 0);
+    EXPECT_LT(cmp.Compare("ab", "ac"), 0);
+    EXPECT_EQ(cmp.Compare("ab", "ab"), 0);
+    EXPECT_GT(cmp.Compare(std::string(1, '\xff'), std::string(1, '\0')), 0);
+}
+
+TEST(comparatorTest, separatorKeepsOrder) {
+    const auto& cmp = leveldb::GLOBAL_COMPARATOR;
+    std::mt19937 rnd(42);
+    for (int i = 0; i < 10000; ++i) {
+        std::string start = randomKey(rnd);
+        std::string limit = randomKey(rnd);
+        if (cmp.Compare(start, limit) >= 0)
+            std::swap(start, limit);
+        if (cmp.Compare(start, limit) == 0)
+            continue;
+        std::string separator = start;
+        cmp.FindShortestSeparator(&separator, limit);
+        EXPECT_LE(cmp.Compare(start, separator), 0);
+        EXPECT_LT(cmp.Compare(separator, limit), 0);
+        EXPECT_GE(separator.size(), start.size());
+    }
+}
+
+TEST(comparatorTest, successorKeepsOrder) {
+    const auto& cmp = leveldb::GLOBAL_COMPARATOR;
+    std::mt19937 rnd(43);
+    for (int i = 0; i < 10000; ++i) {
+        std::string key = randomKey(rnd);
+        std::string successor = key;
+        cmp.FindShortSuccessor(&successor);
+        EXPECT_LE(cmp.Compare(key, successor), 0);
+    }
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "src/db/eventRing.hpp"
+
+using namespace std::chrono_literals;
+
+TEST(eventRingTest, readsPublishedInOrder) {
+    EventRing<int> ring(8);
+    uint64_t pos = ring.end();
+    ring.publish({1, 2, 3});
+    std::vector<EventRing<int>::EventPtr> out;
+    ASSERT_TRUE(ring.read(pos, out, 2, std::chrono::steady_clock::now()));
+    ASSERT_EQ(out.size(), 2);
+    EXPECT_EQ(*out[0], 1);
+    EXPECT_EQ(*out[1], 2);
+    ASSERT_TRUE(ring.read(pos, out, 10, std::chrono::steady_clock::now()));
+    ASSERT_EQ(out.size(), 3);
+    EXPECT_EQ(*out[2], 3);
+    EXPECT_EQ(pos, ring.end());
+
+    //Nothing new: returns once the deadline passes
+    ASSERT_TRUE(ring.read(pos, out, 10, std::chrono::steady_clock::now() + 10ms));
+    EXPECT_EQ(out.size(), 3);
+}
+
+TEST(eventRingTest, overwrittenEventsReported) {
+    EventRing<int> ring(4);
+    uint64_t pos = ring.end();
+    ring.publish({1, 2, 3, 4, 5});
+    std::vector<EventRing<int>::EventPtr> out;
+    EXPECT_FALSE(ring.read(pos, out, 10, std::chrono::steady_clock::now()));
+    EXPECT_TRUE(out.empty());
+
+    pos = 1;
+    ASSERT_TRUE(ring.read(pos, out, 10, std::chrono::steady_clock::now()));
+    ASSERT_EQ(out.size(), 4);
+    EXPECT_EQ(*out[0], 2);
+    EXPECT_EQ(*out[3], 5);
+}
+
+TEST(eventRingTest, waitingReaderWokenByPublishAndClose) {
+    EventRing<int> ring(4);
+    uint64_t pos = ring.end();
+    std::vector<EventRing<int>::EventPtr> out;
+    std::thread publisher([&ring] {
+        std::this_thread::sleep_for(20ms);
+        ring.publish({7});
+    });
+    ASSERT_TRUE(ring.read(pos, out, 10, std::chrono::steady_clock::now() + 10s));
+    publisher.join();
+    ASSERT_EQ(out.size(), 1);
+    EXPECT_EQ(*out[0], 7);
+
+    std::thread closer([&ring] {
+        std::this_thread::sleep_for(20ms);
+        ring.close();
+    });
+    auto started = std::chrono::steady_clock::now();
+    EXPECT_TRUE(ring.read(pos, out, 10, started + 10s));
+    closer.join();
+    EXPECT_LT(std::chrono::steady_clock::now() - started, 5s);
+    EXPECT_TRUE(ring.isClosed());
+}
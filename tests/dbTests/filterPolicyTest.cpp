@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "src/db/filterPolicy.hpp"
+#include "src/db/fullKey.hpp"
+#include "leveldb/db.h"
+
+namespace {
+    std::string buildFilter(const NamespaceFilterPolicy& policy, const std::vector<std::string>& keys) {
+        std::vector<leveldb::Slice> slices(keys.begin(), keys.end());
+        std::string filter;
+        policy.CreateFilter(slices.data(), static_cast<int>(slices.size()), &filter);
+        return filter;
+    }
+}
+
+TEST(filterPolicyTest, historyKeysMatchAnyVersion) {
+    NamespaceFilterPolicy policy(10);
+    std::string filter = buildFilter(policy, {
+        FullKey("key", 1, 0).getFullKey(),
+        FullKey("key", 7, 3).getFullKey(),
+    });
+
+    EXPECT_TRUE(policy.KeyMayMatch(FullKey("key", 1, 0).getFullKey(), filter));
+    EXPECT_TRUE(policy.KeyMayMatch(FullKey("key", 100, 5).getFullKey(), filter));
+    EXPECT_EQ(NamespaceFilterPolicy::filterKey(FullKey("key", 1, 0).getFullKey()),
+              NamespaceFilterPolicy::filterKey(FullKey("key", 2, 1).getFullKey()));
+}
+
+TEST(filterPolicyTest, otherNamespacesHashedWhole) {
+    NamespaceFilterPolicy policy(10);
+    std::string normal = std::string(4, '\0') + "key";
+    std::string getseq = "@" + normal;
+    std::string lseq = "#" + std::string(12, '\1');
+    std::string filter = buildFilter(policy, {lseq, getseq, normal});
+
+    EXPECT_EQ(NamespaceFilterPolicy::filterKey(normal), leveldb::Slice(normal));
+    EXPECT_EQ(NamespaceFilterPolicy::filterKey(lseq), leveldb::Slice(lseq));
+    EXPECT_TRUE(policy.KeyMayMatch(normal, filter));
+    EXPECT_TRUE(policy.KeyMayMatch(getseq, filter));
+    EXPECT_TRUE(policy.KeyMayMatch(lseq, filter));
+}
+
+TEST(filterPolicyTest, absentKeysMostlyRejected) {
+    NamespaceFilterPolicy policy(10);
+    std::vector<std::string> keys;
+    for (int i = 0; i < 1000; ++i) {
+        keys.push_back(FullKey("present" + std::to_string(i), i, 0).getFullKey());
+    }
+    std::string filter = buildFilter(policy, keys);
+
+    int falsePositives = 0;
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(policy.KeyMayMatch(FullKey("present" + std::to_string(i), i + 1, 2).getFullKey(), filter));
+        falsePositives += policy.KeyMayMatch(FullKey("absent" + std::to_string(i), i, 0).getFullKey(), filter);
+    }
+    //About 1% expected with 10 bits per key
+    EXPECT_LT(falsePositives, 50);
+}
@@ -36,4 +36,36 @@ TEST(fullKeyTest, keyToKey) {
     EXPECT_EQ(key.getFullKey()[0], '!');
     EXPECT_EQ(key.getSeq(), 1);
     EXPECT_EQ(key.getReplicaId(), 1);
+}
+
+TEST(fullKeyTest, binaryLayoutOrder) {
+    FullKey key("a", 255, 7);
+    EXPECT_EQ(key.getFullKey().size(), 1 + FullKey::kOverhead);
+    EXPECT_EQ(FullKey(key.getFullKey()).getSeq(), 255);
+    EXPECT_EQ(FullKey(key.getFullKey()).getReplicaId(), 7);
+
+    //seq compares numerically, then replica id
+    EXPECT_LT(FullKey("a", 255, 7).getFullKey(), FullKey("a", 256, 1).getFullKey());
+    EXPECT_LT(FullKey("a", 256, 1).getFullKey(), FullKey("a", 256, 2).getFullKey());
+    EXPECT_LT(FullKey("a", 1ull << 40, 0).getFullKey(), FullKey("b", 0, 0).getFullKey());
+
+    //versions of one key are not interleaved with keys it prefixes
+    EXPECT_LT(FullKey("a", 1ull << 40, 0).getFullKey(), FullKey(std::string("a\0", 2), 0, 0).getFullKey());
+}
+
+TEST(fullKeyTest, viewParsesInPlace) {
+    FullKey key("abc", 112541, 112221);
+    FullKeyView view(key.getFullKey());
+    EXPECT_TRUE(view.isValid());
+    EXPECT_EQ(view.getKey(), leveldb::Slice("abc"));
+    EXPECT_EQ(view.getKey().data(), key.getFullKey().data() + 1 + FullKey::kKeyLengthLength);
+    EXPECT_EQ(view.getSeq(), 112541);
+    EXPECT_EQ(view.getReplicaId(), 112221);
+
+    std::string encoded;
+    FullKey::encode(encoded, leveldb::Slice("abc"), 112541, 112221);
+    EXPECT_EQ(encoded, key.getFullKey());
+
+    EXPECT_FALSE(FullKeyView(leveldb::Slice("!abc")).isValid());
+    EXPECT_FALSE(FullKeyView(leveldb::Slice("#aaaaaaaaaaaaaaa")).isValid());
 }
\ No newline at end of file
@@ -190,4 +190,152 @@ TEST_F(groupOperationTest, multithreadBatchPut) {
         EXPECT_EQ(get_result.lseq, lseqs[i]);
         EXPECT_EQ(get_result.value, values[i]);
     }
-}
\ No newline at end of file
+}
+
+TEST_F(groupOperationTest, rangeAndPrefixScan) {
+    EXPECT_TRUE(db.putBatch({
+        {dbConnector::generateLseqKey(10, 1), dbConnector::generateNormalKey("user:1", 1), "a"},
+        {dbConnector::generateLseqKey(11, 1), dbConnector::generateNormalKey("user:2", 1), "b"},
+        {dbConnector::generateLseqKey(12, 1), dbConnector::generateNormalKey("user:10", 1), "c"},
+        {dbConnector::generateLseqKey(13, 1), dbConnector::generateNormalKey("users", 1), "d"},
+        {dbConnector::generateLseqKey(14, 1), dbConnector::generateNormalKey("user:3", 1), "e"},
+        {dbConnector::generateLseqKey(15, 3), dbConnector::generateNormalKey("user:4", 3), "f"}
+    }).ok());
+
+    replyBatchFormat repl = db.getPrefix("user:", 1);
+    EXPECT_TRUE(repl.response_status.ok());
+    ASSERT_EQ(repl.values.size(), 4);
+    EXPECT_EQ(repl.values[0].key, dbConnector::generateNormalKey("user:1", 1));
+    EXPECT_EQ(repl.values[1].key, dbConnector::generateNormalKey("user:10", 1));
+    EXPECT_EQ(repl.values[2].key, dbConnector::generateNormalKey("user:2", 1));
+    EXPECT_EQ(repl.values[3].key, dbConnector::generateNormalKey("user:3", 1));
+    EXPECT_EQ(repl.values[1].lseq, dbConnector::generateLseqKey(12, 1));
+    EXPECT_EQ(repl.values[1].value, "c");
+
+    repl = db.getPrefix("user:", 1, 2);
+    EXPECT_TRUE(repl.response_status.ok());
+    EXPECT_EQ(repl.values.size(), 2);
+
+    repl = db.getRange("user:10", "user:3", 1);
+    EXPECT_TRUE(repl.response_status.ok());
+    ASSERT_EQ(repl.values.size(), 2);
+    EXPECT_EQ(repl.values[0].value, "c");
+    EXPECT_EQ(repl.values[1].value, "b");
+
+    repl = db.getRange("user:3", "", 1);
+    EXPECT_TRUE(repl.response_status.ok());
+    ASSERT_EQ(repl.values.size(), 2);
+    EXPECT_EQ(repl.values[1].value, "d");
+
+    repl = db.getPrefix("", 3);
+    EXPECT_TRUE(repl.response_status.ok());
+    ASSERT_EQ(repl.values.size(), 1);
+    EXPECT_EQ(repl.values[0].value, "f");
+}
+
+TEST_F(groupOperationTest, multiGet) {
+    int selfId = config.getId();
+    std::string lseqA = db.put("a", "va").lseq;
+    db.put("b", "vb");
+    db.put("b", "vb2");
+    db.put("c", "vc");
+    db.remove("c");
+    EXPECT_TRUE(db.putBatch({
+        {dbConnector::generateLseqKey(3, selfId + 1), dbConnector::generateNormalKey("a", selfId + 1), "other"}
+    }).ok());
+
+    replyBatchFormat repl = db.multiGet({"missing", "b", "c", "a", "b"}, selfId);
+    EXPECT_TRUE(repl.response_status.ok());
+    ASSERT_EQ(repl.values.size(), 2);
+    EXPECT_EQ(dbConnector::stampedKeyToRealKey(repl.values[0].key), "a");
+    EXPECT_EQ(repl.values[0].lseq, lseqA);
+    EXPECT_EQ(repl.values[0].value, "va");
+    EXPECT_EQ(dbConnector::stampedKeyToRealKey(repl.values[1].key), "b");
+    EXPECT_EQ(repl.values[1].value, "vb2");
+    EXPECT_EQ(repl.values[1].lseq, db.get("b").lseq);
+
+    repl = db.multiGet({"a", "b"}, selfId + 1);
+    EXPECT_TRUE(repl.response_status.ok());
+    ASSERT_EQ(repl.values.size(), 1);
+    EXPECT_EQ(repl.values[0].value, "other");
+
+    EXPECT_TRUE(db.multiGet({}, selfId).values.empty());
+}
+
+TEST_F(groupOperationTest, eventCursor) {
+    EXPECT_TRUE(db.putBatch({
+        {dbConnector::generateLseqKey(10, 4), dbConnector::generateNormalKey("a", 4), "0123456789"},
+        {dbConnector::generateLseqKey(20, 4), dbConnector::generateNormalKey("b", 4), "0123456789"},
+        {dbConnector::generateLseqKey(30, 4), dbConnector::generateNormalKey("c", 4), "0123456789"},
+        {dbConnector::generateLseqKey(40, 4), dbConnector::generateNormalKey("d", 4), "0123456789"},
+        {dbConnector::generateLseqKey(15, 5), dbConnector::generateNormalKey("e", 5), "other"}
+    }).ok());
+
+    //Every item is 15 bytes of key and value, so a 20 byte budget ends a chunk after two items
+    auto cursor = db.logCursor(dbConnector::generateLseqKey(0, 4));
+    batchValues chunk;
+    EXPECT_TRUE(cursor->next(chunk, 10, 20));
+    ASSERT_EQ(chunk.size(), 2);
+    EXPECT_EQ(cursor->resumeToken(), dbConnector::generateLseqKey(20, 4));
+
+    //A cursor started after the token continues where this one stopped
+    auto resumed = db.logCursor(cursor->resumeToken(), dbConnector::LSEQ_COMPARE::GREATER);
+    batchValues rest;
+    EXPECT_FALSE(resumed->next(rest, 10, 1000));
+    EXPECT_TRUE(resumed->status().ok());
+    ASSERT_EQ(rest.size(), 2);
+    EXPECT_EQ(rest[0].lseq, dbConnector::generateLseqKey(30, 4));
+    EXPECT_EQ(rest[1].lseq, dbConnector::generateLseqKey(40, 4));
+
+    chunk.clear();
+    EXPECT_TRUE(cursor->next(chunk, 1, 1000));
+    EXPECT_EQ(chunk.size(), 1);
+    EXPECT_FALSE(cursor->next(chunk, 10, 1000));
+    EXPECT_EQ(chunk.size(), 2);
+
+    auto malformed = db.logCursor("#");
+    EXPECT_FALSE(malformed->next(chunk, 10, 1000));
+    EXPECT_TRUE(malformed->status().IsInvalidArgument());
+}
+
+TEST_F(groupOperationTest, keyCursorResumesExactly) {
+    //Versions with equal seq from different replicas
+    EXPECT_TRUE(db.putBatch({
+        {dbConnector::generateLseqKey(5, 1), dbConnector::generateNormalKey("k", 1), "v1"},
+        {dbConnector::generateLseqKey(5, 3), dbConnector::generateNormalKey("k", 3), "v3"},
+        {dbConnector::generateLseqKey(6, 2), dbConnector::generateNormalKey("k", 2), "v2"}
+    }).ok());
+    auto cursor = db.keyCursor("k", 0, 0);
+    batchValues chunk;
+    EXPECT_TRUE(cursor->next(chunk, 1, 1000));
+    ASSERT_EQ(chunk.size(), 1);
+    EXPECT_EQ(chunk[0].value, "v1");
+
+    const std::string& token = cursor->resumeToken();
+    auto resumed = db.keyCursor("k", dbConnector::lseqToSeq(token), dbConnector::lseqToReplicaId(token), dbConnector::LSEQ_COMPARE::GREATER);
+    batchValues rest;
+    EXPECT_FALSE(resumed->next(rest, 10, 1000));
+    ASSERT_EQ(rest.size(), 2);
+    EXPECT_EQ(rest[0].value, "v3");
+    EXPECT_EQ(rest[1].value, "v2");
+}
+
+TEST_F(groupOperationTest, committedEventsPublished) {
+    EventRing<batchValue>& ring = db.recentEvents();
+    uint64_t pos = ring.end();
+    std::string lseq = db.put("watched", "v1").lseq;
+    db.remove("watched");
+    EXPECT_TRUE(db.putBatch({
+        {dbConnector::generateLseqKey(9, 6), dbConnector::generateNormalKey("remote", 6), "v2"}
+    }).ok());
+
+    std::vector<EventRing<batchValue>::EventPtr> events;
+    ASSERT_TRUE(ring.read(pos, events, 10, std::chrono::steady_clock::now()));
+    //Removal leaves no log record, so it is not an event either
+    ASSERT_EQ(events.size(), 2);
+    EXPECT_EQ(events[0]->lseq, lseq);
+    EXPECT_EQ(events[0]->key, dbConnector::generateNormalKey("watched", config.getId()));
+    EXPECT_EQ(events[0]->value, "v1");
+    EXPECT_EQ(events[1]->lseq, dbConnector::generateLseqKey(9, 6));
+    EXPECT_EQ(events[1]->value, "v2");
+}
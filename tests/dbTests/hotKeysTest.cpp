@@ -0,0 +1,45 @@
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "src/db/hotKeys.hpp"
+
+TEST(hotKeysTest, samplesRecentDistinctKeys) {
+    HotKeys hotKeys(3, 2);
+    for (const char* key : {"a", "x", "b", "x", "a", "x", "c", "x"}) {
+        hotKeys.record(key);
+    }
+    //Every second read is sampled, the oldest sample "a" is replaced
+    EXPECT_EQ(hotKeys.keys(), std::vector<std::string>({"c", "a", "b"}));
+
+    HotKeys disabled(0, 1);
+    disabled.record("a");
+    EXPECT_TRUE(disabled.keys().empty());
+}
+
+TEST(hotKeysTest, seededKeysReplacedFirst) {
+    HotKeys hotKeys(3, 1);
+    hotKeys.seed({"s1", "s2", "s3", "s4"});
+    EXPECT_EQ(hotKeys.keys(), std::vector<std::string>({"s1", "s2", "s3"}));
+    hotKeys.record("new");
+    EXPECT_EQ(hotKeys.keys(), std::vector<std::string>({"new", "s1", "s2"}));
+}
+
+TEST(hotKeysTest, saveAndLoad) {
+    std::string path = "hotKeysTest-manifest";
+    std::filesystem::remove(path);
+    std::vector<std::string> keys;
+    ASSERT_TRUE(HotKeys::load(path, keys).ok());
+    EXPECT_TRUE(keys.empty());
+
+    std::vector<std::string> saved = {"a", std::string("\0b", 2), ""};
+    ASSERT_TRUE(HotKeys::save(path, saved).ok());
+    ASSERT_TRUE(HotKeys::load(path, keys).ok());
+    EXPECT_EQ(keys, saved);
+
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 1);
+    EXPECT_TRUE(HotKeys::load(path, keys).IsCorruption());
+    std::filesystem::remove(path);
+}
@@ -9,6 +9,9 @@
 #include "src/utils/yamlConfig.hpp"
 #include "src/utils/grpcConfig.hpp"
 #include "src/db/dbConnector.hpp"
+#include "src/db/comparator.hpp"
+#include "src/db/fullKey.hpp"
+#include "src/db/logRecord.hpp"
 #include "leveldb/db.h"
 
 TEST(restartDbTest, baseCorrectness) {
@@ -32,3 +35,367 @@ TEST(restartDbTest, baseCorrectness) {
     std::filesystem::remove_all(fileName);
 
 }
+
+TEST(restartDbTest, decimalFormatUpgrade) {
+    YAMLConfig config = YAMLConfig("resources/config.yaml");
+    std::string fileName = config.getDbFile();
+    std::filesystem::remove_all(fileName);
+    {
+        //Records of put("k", "v") and replicated "r" as written before binary key format
+        leveldb::Options options;
+        options.create_if_missing = true;
+        options.comparator = &(leveldb::GLOBAL_COMPARATOR);
+        leveldb::DB* raw_db;
+        ASSERT_TRUE(leveldb::DB::Open(options, fileName, &raw_db).ok());
+        std::unique_ptr<leveldb::DB> legacy(raw_db);
+        legacy->Put(leveldb::WriteOptions(), "0000000002k", "v");
+        legacy->Put(leveldb::WriteOptions(), "@000000002k", "#000000002000000000000005");
+        legacy->Put(leveldb::WriteOptions(), "#000000002000000000000005", "0000000002k");
+        legacy->Put(leveldb::WriteOptions(), "!k0000000000000050000000002", "v");
+        legacy->Put(leveldb::WriteOptions(), "0000000001r", "w");
+        legacy->Put(leveldb::WriteOptions(), "@000000001r", "#000000001000000000000003");
+        legacy->Put(leveldb::WriteOptions(), "#000000001000000000000003", "0000000001r");
+        legacy->Put(leveldb::WriteOptions(), "!r0000000000000030000000001", "w");
+    }
+
+    for (int reopen = 0; reopen < 2; ++reopen) {
+        dbConnector db = dbConnector(config);
+        EXPECT_EQ(db.sequenceNumberForReplica(2), 5);
+        EXPECT_EQ(db.sequenceNumberForReplica(1), 3);
+
+        auto value = db.get("k");
+        EXPECT_TRUE(value.response_status.ok());
+        EXPECT_EQ(value.value, "v");
+        EXPECT_EQ(value.lseq, dbConnector::generateLseqKey(5, 2));
+        EXPECT_EQ(db.get("r", 1).value, "w");
+
+        replyBatchFormat repl = db.getByLseq(0, 1);
+        EXPECT_TRUE(repl.response_status.ok());
+        ASSERT_EQ(repl.values.size(), 1);
+        EXPECT_EQ(repl.values[0].key, dbConnector::generateNormalKey("r", 1));
+        EXPECT_EQ(repl.values[0].value, "w");
+
+        repl = db.getAllValuesForKey("k", 0);
+        EXPECT_TRUE(repl.response_status.ok());
+        ASSERT_EQ(repl.values.size(), 1);
+        EXPECT_EQ(repl.values[0].lseq, dbConnector::generateLseqKey(5, 2));
+    }
+
+    std::filesystem::remove_all(fileName);
+}
+
+TEST(restartDbTest, lengthOrderedFormatUpgrade) {
+    YAMLConfig config = YAMLConfig("resources/config.yaml");
+    std::string fileName = config.getDbFile();
+    std::filesystem::remove_all(fileName);
+    leveldb::SequenceNumber legacySeq;
+    {
+        //Binary ids with length-first order: history key has no length prefix
+        leveldb::Options options;
+        options.create_if_missing = true;
+        options.comparator = &(leveldb::GLOBAL_COMPARATOR);
+        leveldb::DB* raw_db;
+        ASSERT_TRUE(leveldb::DB::Open(options, fileName, &raw_db).ok());
+        std::unique_ptr<leveldb::DB> legacy(raw_db);
+        std::string normalKey = dbConnector::generateNormalKey("k", 2);
+        auto [seq, s] = legacy->PutSequence(leveldb::WriteOptions(), normalKey, "v");
+        ASSERT_TRUE(s.ok());
+        legacySeq = seq;
+        std::string lseq = dbConnector::generateLseqKey(seq, 2);
+        std::string historyKey = std::string("!k") + lseq.substr(5) + lseq.substr(1, 4);
+        legacy->Put(leveldb::WriteOptions(), "@" + normalKey, lseq);
+        legacy->Put(leveldb::WriteOptions(), lseq, normalKey);
+        legacy->Put(leveldb::WriteOptions(), historyKey, "v");
+        legacy->Put(leveldb::WriteOptions(), "~format", "2");
+    }
+
+    {
+        dbConnector db = dbConnector(config);
+        EXPECT_EQ(db.sequenceNumberForReplica(2), legacySeq);
+        EXPECT_EQ(db.get("k").value, "v");
+
+        replyBatchFormat repl = db.getAllValuesForKey("k", 0);
+        EXPECT_TRUE(repl.response_status.ok());
+        ASSERT_EQ(repl.values.size(), 1);
+        EXPECT_EQ(repl.values[0].lseq, dbConnector::generateLseqKey(legacySeq, 2));
+
+        //Local lseq keeps growing although the upgraded database starts its own sequence numbers anew
+        std::string newLseq = db.put("k", "v2").lseq;
+        EXPECT_GT(dbConnector::lseqToSeq(newLseq), legacySeq);
+        EXPECT_EQ(db.get("k").value, "v2");
+    }
+    EXPECT_FALSE(std::filesystem::exists(fileName + ".old"));
+    EXPECT_FALSE(std::filesystem::exists(fileName + ".upgrade"));
+
+    std::filesystem::remove_all(fileName);
+}
+
+TEST(restartDbTest, bareLogFormatUpgrade) {
+    YAMLConfig config = YAMLConfig("resources/config.yaml");
+    std::string fileName = config.getDbFile();
+    std::filesystem::remove_all(fileName);
+    std::string firstLseq = dbConnector::generateLseqKey(4, 2);
+    std::string secondLseq = dbConnector::generateLseqKey(7, 2);
+    {
+        //Log records without values; the first one was converted before the upgrade was interrupted
+        leveldb::Options options;
+        options.create_if_missing = true;
+        leveldb::DB* raw_db;
+        ASSERT_TRUE(leveldb::DB::Open(options, fileName, &raw_db).ok());
+        std::unique_ptr<leveldb::DB> legacy(raw_db);
+        std::string firstKey = dbConnector::generateNormalKey("a", 2);
+        std::string secondKey = dbConnector::generateNormalKey("b", 2);
+        legacy->Put(leveldb::WriteOptions(), firstKey, "va");
+        legacy->Put(leveldb::WriteOptions(), "@" + firstKey, firstLseq);
+        legacy->Put(leveldb::WriteOptions(), firstLseq, LogRecord::encode(firstKey, "va"));
+        legacy->Put(leveldb::WriteOptions(), FullKey("a", 4, 2).getFullKey(), "va");
+        legacy->Put(leveldb::WriteOptions(), secondKey, "vb");
+        legacy->Put(leveldb::WriteOptions(), "@" + secondKey, secondLseq);
+        legacy->Put(leveldb::WriteOptions(), secondLseq, secondKey);
+        legacy->Put(leveldb::WriteOptions(), FullKey("b", 7, 2).getFullKey(), "vb");
+        legacy->Put(leveldb::WriteOptions(), "~logupgrade", firstLseq);
+        legacy->Put(leveldb::WriteOptions(), "~format", "3");
+    }
+
+    for (int reopen = 0; reopen < 2; ++reopen) {
+        dbConnector db = dbConnector(config);
+        EXPECT_EQ(db.get("a").value, "va");
+        EXPECT_EQ(db.get("b").value, "vb");
+
+        replyBatchFormat repl = db.getByLseq(0, 2);
+        EXPECT_TRUE(repl.response_status.ok());
+        ASSERT_EQ(repl.values.size(), 2);
+        EXPECT_EQ(repl.values[0].lseq, firstLseq);
+        EXPECT_EQ(repl.values[0].value, "va");
+        EXPECT_EQ(repl.values[1].key, dbConnector::generateNormalKey("b", 2));
+        EXPECT_EQ(repl.values[1].value, "vb");
+    }
+
+    std::filesystem::remove_all(fileName);
+}
+
+TEST(restartDbTest, lseqNeverReused) {
+    YAMLConfig config = YAMLConfig("resources/config.yaml");
+    std::string fileName = config.getDbFile();
+    std::filesystem::remove_all(fileName);
+    std::string removeLseq;
+    {
+        dbConnector db = dbConnector(config);
+        std::string firstLseq = db.put("a", "1").lseq;
+        std::string secondLseq = db.put("b", "2").lseq;
+        //One lseq per write, all records of a write share it
+        EXPECT_EQ(dbConnector::lseqToSeq(secondLseq), dbConnector::lseqToSeq(firstLseq) + 1);
+        removeLseq = db.remove("a").lseq;
+        EXPECT_EQ(dbConnector::lseqToSeq(removeLseq), dbConnector::lseqToSeq(secondLseq) + 1);
+    }
+
+    {
+        //Removal leaves no lseq log record, its lseq must not be handed out again
+        dbConnector db = dbConnector(config);
+        EXPECT_EQ(db.sequenceNumberForReplica(2), dbConnector::lseqToSeq(removeLseq));
+        EXPECT_GT(db.put("c", "3").lseq, removeLseq);
+        EXPECT_TRUE(db.get("a").response_status.IsNotFound());
+    }
+    std::filesystem::remove_all(fileName);
+}
+
+namespace {
+    void removeSplitDatabase(const std::string& fileName) {
+        for (const char* suffix : {"", "-getseq", "-lseq", "-history"}) {
+            std::filesystem::remove_all(fileName + suffix);
+        }
+    }
+}
+
+TEST(restartDbTest, splitNamespaces) {
+    YAMLConfig config = YAMLConfig("resources/splitConfig.yaml");
+    std::string fileName = config.getDbFile();
+    removeSplitDatabase(fileName);
+    std::string lseq;
+    std::string lastLseq;
+    {
+        dbConnector db = dbConnector(config);
+        db.put("a", "1");
+        lseq = db.put("a", "2").lseq;
+        db.put("b", "3");
+        //Removal takes the last seq of the replica, although the log has no record of it
+        lastLseq = db.remove("b").lseq;
+        EXPECT_FALSE(lastLseq.empty());
+        EXPECT_TRUE(db.get("b").response_status.IsNotFound());
+    }
+    EXPECT_TRUE(std::filesystem::exists(fileName + "-lseq"));
+
+    {
+        //Crash between lseq log and getseq index writes
+        leveldb::DB* raw_db;
+        ASSERT_TRUE(leveldb::DB::Open(leveldb::Options(), fileName + "-getseq", &raw_db).ok());
+        std::unique_ptr<leveldb::DB> getseq(raw_db);
+        getseq->Delete(leveldb::WriteOptions(), "@" + dbConnector::generateNormalKey("a", 2));
+    }
+
+    {
+        dbConnector db = dbConnector(config);
+        EXPECT_EQ(db.sequenceNumberForReplica(2), dbConnector::lseqToSeq(lastLseq));
+        pureReplyValue value = db.get("a");
+        EXPECT_TRUE(value.response_status.ok());
+        EXPECT_EQ(value.value, "2");
+        EXPECT_EQ(value.lseq, lseq);
+
+        replyBatchFormat history = db.getAllValuesForKey("a", 0);
+        ASSERT_EQ(history.values.size(), 2);
+        EXPECT_EQ(history.values[1].value, "2");
+
+        replyBatchFormat log = db.getByLseq(0, 2);
+        ASSERT_EQ(log.values.size(), 3);
+        EXPECT_EQ(log.values[2].value, "3");
+
+        replyBatchFormat range = db.getRange("", "", 2);
+        ASSERT_EQ(range.values.size(), 1);
+        EXPECT_EQ(range.values[0].lseq, lseq);
+    }
+    removeSplitDatabase(fileName);
+}
+
+TEST(restartDbTest, layoutIsFixedAtCreation) {
+    std::string fileName = YAMLConfig("resources/config.yaml").getDbFile();
+    removeSplitDatabase(fileName);
+    {
+        dbConnector db = dbConnector(YAMLConfig("resources/config.yaml"));
+        db.put("a", "1");
+    }
+    YAMLConfig splitConfig("resources/splitConfig.yaml");
+    try {
+        dbConnector db = dbConnector(splitConfig);
+        FAIL() << "database opened with another layout";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find("layout"), std::string::npos);
+    }
+    removeSplitDatabase(fileName);
+}
+
+TEST(restartDbTest, historyRetention) {
+    //Keeps the newest two versions and everything younger than a second
+    YAMLConfig config("resources/retentionConfig.yaml");
+    std::string fileName = config.getDbFile();
+    std::filesystem::remove_all(fileName);
+    auto versionsOf = [](dbConnector& db, int id) {
+        std::vector<std::string> values;
+        for (const auto& item : db.getAllValuesForKey("k", 0).values) {
+            if (dbConnector::lseqToReplicaId(item.lseq) == id)
+                values.push_back(item.value);
+        }
+        return values;
+    };
+    std::string lastLseq;
+    {
+        dbConnector db = dbConnector(config);
+        for (int i = 0; i < 4; ++i) {
+            db.put("k", "v" + std::to_string(i));
+        }
+        lastLseq = db.put("other", "o").lseq;
+        batchValues replicated;
+        for (int seq = 1; seq <= 3; ++seq) {
+            replicated.push_back({dbConnector::generateLseqKey(seq, 1), dbConnector::generateNormalKey("k", 1), "r" + std::to_string(seq)});
+        }
+        ASSERT_TRUE(db.putBatch(replicated).ok());
+
+        //Nothing is a second old yet
+        ASSERT_TRUE(db.collectHistory().ok());
+        EXPECT_EQ(db.getAllValuesForKey("k", 0).values.size(), 7);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+        ASSERT_TRUE(db.collectHistory().ok());
+        EXPECT_EQ(versionsOf(db, 2), std::vector<std::string>({"v2", "v3"}));
+        EXPECT_EQ(versionsOf(db, 1), std::vector<std::string>({"r2", "r3"}));
+        EXPECT_EQ(db.getAllValuesForKey("other", 0).values.size(), 1);
+
+        //Expired versions leave the log too, latest values are untouched
+        replyBatchFormat log = db.getByLseq(0, 2);
+        ASSERT_EQ(log.values.size(), 3);
+        EXPECT_EQ(log.values[0].value, "v2");
+        EXPECT_EQ(db.get("k").value, "v3");
+        EXPECT_EQ(db.get("k", 1).value, "r3");
+        EXPECT_EQ(db.get("other").value, "o");
+    }
+    {
+        //Versions written before the restart keep their age
+        dbConnector db = dbConnector(config);
+        EXPECT_EQ(db.sequenceNumberForReplica(2), dbConnector::lseqToSeq(lastLseq));
+        db.put("k", "v4");
+        db.put("k", "v5");
+        ASSERT_TRUE(db.collectHistory().ok());
+        EXPECT_EQ(versionsOf(db, 2), std::vector<std::string>({"v4", "v5"}));
+        EXPECT_EQ(db.get("k").value, "v5");
+    }
+    std::filesystem::remove_all(fileName);
+}
+
+TEST(restartDbTest, seqMarksCheckedAgainstLog) {
+    YAMLConfig config("resources/splitConfig.yaml");
+    std::string fileName = config.getDbFile();
+    removeSplitDatabase(fileName);
+    std::string putLseq;
+    std::string removeLseq;
+    {
+        dbConnector db = dbConnector(config);
+        putLseq = db.put("a", "1").lseq;
+        ASSERT_TRUE(db.putBatch({{dbConnector::generateLseqKey(7, 1), dbConnector::generateNormalKey("x", 1), "v"}}).ok());
+        removeLseq = db.remove("a").lseq;
+    }
+    {
+        dbConnector db = dbConnector(config);
+        EXPECT_EQ(db.sequenceNumberForReplica(2), dbConnector::lseqToSeq(removeLseq));
+        EXPECT_EQ(db.sequenceNumberForReplica(1), 7);
+        EXPECT_EQ(db.sequenceNumberForReplica(0), 0);
+    }
+    {
+        //Database from before marks were kept: the last log records are used
+        leveldb::DB* raw_db;
+        ASSERT_TRUE(leveldb::DB::Open(leveldb::Options(), fileName + "-lseq", &raw_db).ok());
+        std::unique_ptr<leveldb::DB> lseqDb(raw_db);
+        for (int id : {1, 2}) {
+            std::string key = "~seqmark";
+            KeyCoding::appendFixed32(key, id);
+            ASSERT_TRUE(lseqDb->Delete(leveldb::WriteOptions(), key).ok());
+        }
+    }
+    {
+        dbConnector db = dbConnector(config);
+        EXPECT_EQ(db.sequenceNumberForReplica(2), dbConnector::lseqToSeq(putLseq));
+        EXPECT_EQ(db.sequenceNumberForReplica(1), 7);
+    }
+    removeSplitDatabase(fileName);
+}
+
+TEST(restartDbTest, cacheWarmupAfterRestart) {
+    YAMLConfig config("resources/config.yaml");
+    std::string fileName = config.getDbFile();
+    std::filesystem::remove_all(fileName);
+    std::filesystem::remove(fileName + "-warmup");
+    {
+        dbConnector db = dbConnector(config);
+        for (int i = 0; i < 100; ++i) {
+            db.put("k" + std::to_string(i), std::to_string(i));
+        }
+        //Every key is read often enough to be sampled
+        for (int i = 0; i < 100; ++i) {
+            for (int j = 0; j < 16; ++j) {
+                db.get("k" + std::to_string(i));
+            }
+        }
+    }
+    EXPECT_TRUE(std::filesystem::exists(fileName + "-warmup"));
+    {
+        dbConnector db = dbConnector(config);
+        while (!db.warmedUp()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        ValueCache::Stats before = db.valueCacheStats();
+        for (int i = 0; i < 100; ++i) {
+            EXPECT_EQ(db.get("k" + std::to_string(i)).value, std::to_string(i));
+        }
+        EXPECT_EQ(db.valueCacheStats().hits, before.hits + 100);
+    }
+    std::filesystem::remove_all(fileName);
+    std::filesystem::remove(fileName + "-warmup");
+}
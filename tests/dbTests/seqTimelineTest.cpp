@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "src/db/seqTimeline.hpp"
+
+TEST(seqTimelineTest, coveredAtNewestOldEnoughSample) {
+    SeqTimeline timeline;
+    EXPECT_TRUE(timeline.coveredAt(1000).empty());
+    EXPECT_TRUE(timeline.record(100, {1, 5}, 10));
+    EXPECT_TRUE(timeline.record(200, {3, 7}, 10));
+    EXPECT_TRUE(timeline.coveredAt(99).empty());
+    EXPECT_EQ(timeline.coveredAt(100), std::vector<uint64_t>({1, 5}));
+    EXPECT_EQ(timeline.coveredAt(199), std::vector<uint64_t>({1, 5}));
+    EXPECT_EQ(timeline.coveredAt(500), std::vector<uint64_t>({3, 7}));
+}
+
+TEST(seqTimelineTest, recordSkipsWithinResolution) {
+    SeqTimeline timeline;
+    EXPECT_TRUE(timeline.record(100, {1}, 50));
+    EXPECT_FALSE(timeline.record(120, {2}, 50));
+    EXPECT_TRUE(timeline.record(150, {3}, 50));
+    EXPECT_EQ(timeline.size(), 2);
+    //Clock went back: the sample still comes after the newest one
+    EXPECT_TRUE(timeline.record(0, {4}, -1000));
+    EXPECT_EQ(timeline.coveredAt(150), std::vector<uint64_t>({4}));
+}
+
+TEST(seqTimelineTest, trimKeepsCoveringSample) {
+    SeqTimeline timeline;
+    timeline.record(100, {1}, 1);
+    timeline.record(200, {2}, 1);
+    timeline.record(300, {3}, 1);
+    timeline.trimBefore(250);
+    EXPECT_EQ(timeline.size(), 2);
+    EXPECT_EQ(timeline.coveredAt(250), std::vector<uint64_t>({2}));
+    timeline.trimBefore(50);
+    EXPECT_EQ(timeline.size(), 2);
+}
+
+TEST(seqTimelineTest, encodeDecode) {
+    SeqTimeline timeline;
+    timeline.record(100, {1, 2, 3}, 1);
+    timeline.record(200, {4, 5, 6}, 1);
+    std::string encoded = timeline.encode();
+
+    SeqTimeline decoded;
+    ASSERT_TRUE(decoded.decode(encoded));
+    EXPECT_EQ(decoded.size(), 2);
+    EXPECT_EQ(decoded.coveredAt(150), std::vector<uint64_t>({1, 2, 3}));
+    EXPECT_EQ(decoded.encode(), encoded);
+
+    EXPECT_FALSE(decoded.decode(encoded.substr(0, encoded.size() - 1)));
+    EXPECT_FALSE(decoded.decode(encoded + "x"));
+    EXPECT_EQ(decoded.size(), 2);
+}
@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "src/db/snapshotManager.hpp"
+#include "leveldb/db.h"
+
+class snapshotManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        std::filesystem::remove_all(kFileName);
+        leveldb::Options options;
+        options.create_if_missing = true;
+        leveldb::DB* raw_db;
+        ASSERT_TRUE(leveldb::DB::Open(options, kFileName, &raw_db).ok());
+        db.reset(raw_db);
+    }
+
+    void TearDown() override {
+        db.reset();
+        std::filesystem::remove_all(kFileName);
+    }
+
+    const std::string kFileName = "snapshotDb";
+    std::unique_ptr<leveldb::DB> db;
+};
+
+TEST_F(snapshotManagerTest, sharedWithinEpoch) {
+    SnapshotManager manager({db.get()}, std::chrono::seconds(10));
+    auto first = manager.acquire();
+    auto second = manager.acquire();
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(snapshotManagerTest, writeEndsSharing) {
+    SnapshotManager manager({db.get()}, std::chrono::seconds(10));
+    auto before = manager.acquire();
+    db->Put(leveldb::WriteOptions(), "k", "v");
+    manager.advance();
+    auto after = manager.acquire();
+    EXPECT_NE(before, after);
+
+    leveldb::ReadOptions options;
+    std::string value;
+    options.snapshot = before->get(0);
+    EXPECT_TRUE(db->Get(options, "k", &value).IsNotFound());
+    options.snapshot = after->get(0);
+    EXPECT_TRUE(db->Get(options, "k", &value).ok());
+}
+
+TEST_F(snapshotManagerTest, epochEndsSharing) {
+    SnapshotManager manager({db.get()}, std::chrono::microseconds(0));
+    auto first = manager.acquire();
+    auto second = manager.acquire();
+    EXPECT_NE(first, second);
+}
+
+TEST_F(snapshotManagerTest, releasedWithLastReader) {
+    SnapshotManager manager({db.get()}, std::chrono::seconds(10));
+    std::weak_ptr<const SnapshotManager::SnapshotSet> released = manager.acquire();
+    EXPECT_TRUE(released.expired());
+    auto next = manager.acquire();
+    EXPECT_NE(next, nullptr);
+}
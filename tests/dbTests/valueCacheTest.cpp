@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "src/db/valueCache.hpp"
+
+TEST(valueCacheTest, lookupAfterUpdate) {
+    ValueCache cache(1024, 4);
+    ValueCache::Entry entry;
+    uint64_t ticket;
+    EXPECT_FALSE(cache.lookup("key", entry, ticket));
+
+    cache.update("key", {"lseq1", "value1"});
+    ASSERT_TRUE(cache.lookup("key", entry, ticket));
+    EXPECT_EQ(entry.lseq, "lseq1");
+    EXPECT_EQ(entry.value, "value1");
+
+    cache.update("key", {"lseq2", "value2"});
+    ASSERT_TRUE(cache.lookup("key", entry, ticket));
+    EXPECT_EQ(entry.value, "value2");
+
+    cache.erase("key");
+    EXPECT_FALSE(cache.lookup("key", entry, ticket));
+
+    EXPECT_EQ(cache.stats().hits, 2);
+    EXPECT_EQ(cache.stats().misses, 2);
+}
+
+TEST(valueCacheTest, fillDroppedAfterWrite) {
+    ValueCache cache(1024, 1);
+    ValueCache::Entry entry;
+    uint64_t ticket;
+    EXPECT_FALSE(cache.lookup("key", entry, ticket));
+    //Write lands between the miss and the fill: the value read before it must not be cached
+    cache.update("key", {"lseq2", "new"});
+    cache.fill("key", {"lseq1", "old"}, ticket);
+    ASSERT_TRUE(cache.lookup("key", entry, ticket));
+    EXPECT_EQ(entry.value, "new");
+
+    EXPECT_FALSE(cache.lookup("removed", entry, ticket));
+    cache.erase("removed");
+    cache.fill("removed", {"lseq1", "old"}, ticket);
+    EXPECT_FALSE(cache.lookup("removed", entry, ticket));
+
+    cache.fill("removed", {"lseq1", "old"}, ticket);
+    ASSERT_TRUE(cache.lookup("removed", entry, ticket));
+    EXPECT_EQ(entry.value, "old");
+}
+
+TEST(valueCacheTest, evictsLeastRecentlyUsed) {
+    //Every entry below takes 10 bytes, the single shard holds three
+    ValueCache cache(30, 1);
+    ValueCache::Entry entry;
+    uint64_t ticket;
+    cache.update("k1", {"l1", "value1"});
+    cache.update("k2", {"l2", "value2"});
+    cache.update("k3", {"l3", "value3"});
+    EXPECT_TRUE(cache.lookup("k1", entry, ticket));
+    cache.update("k4", {"l4", "value4"});
+
+    EXPECT_FALSE(cache.lookup("k2", entry, ticket));
+    EXPECT_TRUE(cache.lookup("k1", entry, ticket));
+    EXPECT_TRUE(cache.lookup("k3", entry, ticket));
+    EXPECT_TRUE(cache.lookup("k4", entry, ticket));
+
+    cache.update("big", {"l5", std::string(100, 'x')});
+    EXPECT_FALSE(cache.lookup("big", entry, ticket));
+    EXPECT_TRUE(cache.lookup("k4", entry, ticket));
+}
+
+TEST(valueCacheTest, disabled) {
+    ValueCache cache(0, 16);
+    ValueCache::Entry entry;
+    uint64_t ticket;
+    EXPECT_FALSE(cache.enabled());
+    cache.update("key", {"lseq", "value"});
+    EXPECT_FALSE(cache.lookup("key", entry, ticket));
+    EXPECT_EQ(cache.stats().misses, 0);
+}